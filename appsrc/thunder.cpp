@@ -212,6 +212,20 @@ void readPara(OptimiserPara &dst, const Json::Value src)
     dst.perturbFactorSGlobal = JSONCPP_READ_ERROR_HANDLER(src, "Professional", KEY_PERTURB_FACTOR_S_GLOBAL).asFloat();
     dst.perturbFactorSLocal = JSONCPP_READ_ERROR_HANDLER(src, "Professional", KEY_PERTURB_FACTOR_S_LOCAL).asFloat();
     dst.perturbFactorSCTF = JSONCPP_READ_ERROR_HANDLER(src, "Professional", KEY_PERTURB_FACTOR_S_CTF).asFloat();
+    if (src["Professional"].isMember(KEY_RANDOM_SEED))
+        dst.randomSeed = src["Professional"][KEY_RANDOM_SEED].asInt();
+    if (src["Professional"].isMember(KEY_MASTER_SHARE_NODE))
+        dst.masterShareNode = src["Professional"][KEY_MASTER_SHARE_NODE].asBool();
+    if (src["Professional"].isMember(KEY_FREEZE_CONVERGED))
+        dst.freezeConverged = src["Professional"][KEY_FREEZE_CONVERGED].asBool();
+    if (src["Professional"].isMember(KEY_SYM_INSERT))
+        dst.symInsert = src["Professional"][KEY_SYM_INSERT].asBool();
+    if (src["Professional"].isMember(KEY_MKB_INSERT))
+        dst.mkbInsert = src["Professional"][KEY_MKB_INSERT].asBool();
+    if (src["Professional"].isMember(KEY_SAVE_IMG_ITER_INTERVAL))
+        dst.saveImgIterInterval = src["Professional"][KEY_SAVE_IMG_ITER_INTERVAL].asInt();
+    if (src["Professional"].isMember(KEY_SAVE_IMG_STRIDE))
+        dst.saveImgStride = src["Professional"][KEY_SAVE_IMG_STRIDE].asInt();
     dst.skipE = JSONCPP_READ_ERROR_HANDLER(src, "Professional", KEY_SKIP_E).asBool();
     dst.skipM = JSONCPP_READ_ERROR_HANDLER(src, "Professional", KEY_SKIP_M).asBool();
     dst.skipR = JSONCPP_READ_ERROR_HANDLER(src, "Professional", KEY_SKIP_R).asBool();
@@ -481,6 +495,8 @@ int main(int argc, char *argv[])
     }
 
     opt.run();
+    opt.clear();
+
     MPI_Finalize();
     TSFFTW_cleanup_threads();
 
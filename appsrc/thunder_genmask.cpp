@@ -59,9 +59,11 @@ void usage (int status)
         fputs("--ext          set the extension for the pixels whose value larger than the threshold, in pixel.\n", stdout);
         fputs("--edgewidth    set the edge width of the mask.\n", stdout);
         fputs("-j             set the number of threads to carry out work.\n", stdout);
+        fputs("--keep         set the number of the largest connected components kept, 0 for all (optional, default 0).\n", stdout);
+        fputs("--minsize      set the minimum number of voxels of a kept connected component (optional, default 2).\n", stdout);
 
         fputs("\n--help         display this help\n", stdout);
-        fputs("Note: all parameters are indispensable.\n", stdout);
+        fputs("Note: all parameters except the optional ones are indispensable.\n", stdout);
     }
     exit(status);
 }
@@ -74,6 +76,8 @@ static const struct option long_options[] =
     {"ext", required_argument, NULL, 'x'},
     {"edgewidth", required_argument, NULL, 'e'},
     {"pixelsize", required_argument, NULL, 'p'},
+    {"keep", required_argument, NULL, 'k'},
+    {"minsize", required_argument, NULL, 'm'},
     {"help", no_argument, NULL, 'h'},
     {NULL, 0, NULL, 0}
 };
@@ -86,6 +90,8 @@ int main(int argc, char* argv[])
     char* input;
     double threshold, ext, edgewidth, pixelsize;
     int nThread;
+    int nKeep = GEN_MASK_N_COMPONENT;
+    size_t minSize = GEN_MASK_MIN_COMPONENT;
 
     char option[7] = {'o', 'i', 't', 'x', 'e', 'p', 'j'};
 
@@ -128,6 +134,12 @@ int main(int argc, char* argv[])
                 nThread = atoi(optarg);
                 option[6] = '\0';
                 break;
+            case('k'):
+                nKeep = atoi(optarg);
+                break;
+            case('m'):
+                minSize = atol(optarg);
+                break;
             case('h'):
                 usage(EXIT_SUCCESS);
                 break;
@@ -170,6 +182,8 @@ int main(int argc, char* argv[])
             threshold,
             ext,
             edgewidth,
+            nKeep,
+            minSize,
             nThread);
 
     CLOG(INFO, "LOGGER_SYS") << "Writing Mask";
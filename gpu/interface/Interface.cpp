@@ -548,7 +548,7 @@ void InsertI2D(Complex* F2D,
 }
 
 void InsertFT(Volume& F3D,
-              Volume& T3D,
+              RealFTVolume& T3D,
               double* O3D,
               int* counter,
               MPI_Comm& hemi,
@@ -578,14 +578,8 @@ void InsertFT(Volume& F3D,
 
     Complex *comF3D = &F3D[0];
 
-    RFLOAT *douT3D = new RFLOAT[dimSize];
-	for(int i = 0; i < dimSize; i++)
-	{
-        douT3D[i] = REAL(T3D[i]);
-	}
-
     cuthunder::InsertFT(reinterpret_cast<cuthunder::Complex*>(comF3D),
-                        douT3D,
+                        T3D.dataFT(),
                         O3D,
                         counter,
                         hemi,
@@ -610,17 +604,10 @@ void InsertFT(Volume& F3D,
                         imgNum,
                         idim,
                         F3D.nSlcFT());
-
-    for(int i = 0; i < dimSize; i++)
-	{
-        T3D[i] = COMPLEX(douT3D[i], 0);
-	}
-
-    delete[]douT3D;
 }
 
 void InsertFT(Volume& F3D,
-              Volume& T3D,
+              RealFTVolume& T3D,
               double* O3D,
               int* counter,
               MPI_Comm& hemi,
@@ -649,14 +636,8 @@ void InsertFT(Volume& F3D,
 
     Complex *comF3D = &F3D[0];
 
-    RFLOAT *douT3D = new RFLOAT[dimSize];
-	for(int i = 0; i < dimSize; i++)
-	{
-        douT3D[i] = REAL(T3D[i]);
-	}
-
     cuthunder::InsertFT(reinterpret_cast<cuthunder::Complex*>(comF3D),
-                        douT3D,
+                        T3D.dataFT(),
                         O3D,
                         counter,
                         hemi,
@@ -680,18 +661,11 @@ void InsertFT(Volume& F3D,
                         imgNum,
                         idim,
                         F3D.nSlcFT());
-
-    for(int i = 0; i < dimSize; i++)
-	{
-        T3D[i] = COMPLEX(douT3D[i], 0);
-	}
-
-    delete[]douT3D;
 }
 
 void PrepareTF(int gpuIdx,
                Volume& F3D,
-	           Volume& T3D,
+	           RealFTVolume& T3D,
 	           double* symMat,
                int nSymmetryElement,
                int maxRadius,
@@ -699,38 +673,23 @@ void PrepareTF(int gpuIdx,
 {
 	LOG(INFO) << "Step1: Prepare Parameter for NormalizeT.";
 
-	RFLOAT sf = 1.0 / REAL(T3D[0]);
+	RFLOAT sf = 1.0 / T3D[0];
     int dim = T3D.nSlcFT();
-    int dimSize = dim * dim * (dim / 2 + 1);
     int r = (maxRadius * pf + 1) * (maxRadius * pf + 1);
 
     Complex *comF3D = &F3D[0];
-	Complex *comT3D = &T3D[0];
-    RFLOAT *douT3D = new RFLOAT[dimSize];
-	for(int i = 0; i < dimSize; i++)
-	{
-        douT3D[i] = REAL(comT3D[i]);
-	}
-
 
     LOG(INFO) << "Step2: Start PrepareTF...";
 
     cuthunder::PrepareTF(gpuIdx,
                          reinterpret_cast<cuthunder::Complex*>(comF3D),
-                         douT3D,
+                         T3D.dataFT(),
                          symMat,
                          sf,
                          nSymmetryElement,
                          LINEAR_INTERP,
                          dim,
                          r);
-
-    for(int i = 0; i < dimSize; i++)
-	{
-        comT3D[i] = COMPLEX(douT3D[i], 0);
-	}
-
-    delete[]douT3D;
 }
 
 void ExposePT2D(int gpuIdx,
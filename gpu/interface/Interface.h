@@ -6,6 +6,7 @@
 #include "ImageFunctions.h"
 #include "Particle.h"
 #include "Volume.h"
+#include "RealFTVolume.h"
 #include "Symmetry.h"
 #include "Database.h"
 #include "Typedef.h"
@@ -265,7 +266,7 @@ void InsertI2D(Complex* F2D,
                int imgNum);
 
 void InsertFT(Volume& F3D,
-              Volume& T3D,
+              RealFTVolume& T3D,
               double* O3D,
               int* counter,
               MPI_Comm& hemi,
@@ -292,7 +293,7 @@ void InsertFT(Volume& F3D,
               int imgNum);
 
 void InsertFT(Volume& F3D,
-              Volume& T3D,
+              RealFTVolume& T3D,
               double* O3D,
               int* counter,
               MPI_Comm& hemi,
@@ -319,7 +320,7 @@ void InsertFT(Volume& F3D,
 
 void PrepareTF(int gpuIdx,
                Volume& F3D,
-	           Volume& T3D,
+	           RealFTVolume& T3D,
 	           double* symMat,
                int nSymmetryElement,
 	           int maxRadius,
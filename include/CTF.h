@@ -18,6 +18,8 @@
 #ifndef CTF_H
 #define CTF_H
 
+#include <vector>
+
 #include "Complex.h"
 #include "Functions.h"
 #include "Image.h"
@@ -91,4 +93,91 @@ void CTF(RFLOAT* dst,                       /**< [out] @f$I@f$ */
          const unsigned int nThread         /**< [in] the number of threads to be used */
          );
 
+/**
+ * @brief The CTFGeometry class stores the geometry of certain pixels in Fourier space which is shared by the CTFs of all images of the same size and pixel size.
+ *
+ * For each pixel, it stores @f$H^2@f$, @f$\cos(2\alpha_g)@f$ and @f$\sin(2\alpha_g)@f$, so that evaluating a CTF on these pixels needs neither atan2 nor a square root.
+ */
+class CTFGeometry
+{
+    private:
+
+        /**
+         * @f$H^2@f$ of each pixel
+         */
+        vector<RFLOAT> _f2;
+
+        /**
+         * @f$\cos(2\alpha_g)@f$ of each pixel
+         */
+        vector<RFLOAT> _c2;
+
+        /**
+         * @f$\sin(2\alpha_g)@f$ of each pixel
+         */
+        vector<RFLOAT> _s2;
+
+    public:
+
+        /**
+         * @brief Tabulate the geometry of the pixels.
+         *
+         * @f$X@f$ and @f$Y@f$ are the number of columns and rows of the image in real space. @f$x_i@f$ and @f$y_i@f$ are the column and row number of the i-th pixel.
+         */
+        void init(const RFLOAT pixelSize, /**< [in] @f$a@f$ */
+                  const int nCol,         /**< [in] @f$X@f$ */
+                  const int nRow,         /**< [in] @f$Y@f$ */
+                  const int* iCol,        /**< [in] @f$x_i@f$ */
+                  const int* iRow,        /**< [in] @f$y_i@f$ */
+                  const int nPxl          /**< [in] @f$N@f$ */
+                 );
+
+        /**
+         * @brief Free the tables.
+         */
+        void clear();
+
+        inline int nPxl() const { return _f2.size(); };
+
+        inline const RFLOAT* f2() const { return _f2.empty() ? NULL : &_f2[0]; };
+
+        inline const RFLOAT* c2() const { return _c2.empty() ? NULL : &_c2[0]; };
+
+        inline const RFLOAT* s2() const { return _s2.empty() ? NULL : &_s2[0]; };
+};
+
+/**
+ * @brief This function computes the CTF values of the pixels tabulated in a CTFGeometry, output in a float array @f$I@f$.
+ *
+ * As @f$w_1 = \sqrt{1 - A^2}@f$ and @f$w_2 = A@f$, @f$CTF = -\sin(\chi - \arcsin{A})@f$, which only takes one sine per pixel, evaluated 8 pixels at a time when SIMD is enabled in single precision.
+ */
+void CTF(RFLOAT* dst,                       /**< [out] @f$I@f$ */
+         const CTFGeometry& geom,           /**< [in] geometry of the pixels */
+         const RFLOAT voltage,              /**< [in] @f$V@f$ */
+         const RFLOAT defocusU,             /**< [in] @f$\Delta f_1@f$ */
+         const RFLOAT defocusV,             /**< [in] @f$\Delta f_2@f$ */
+         const RFLOAT theta,                /**< [in] @f$\alpha{_{\alpha st}}@f$ */
+         const RFLOAT Cs,                   /**< [in] @f$C_S@f$ */
+         const RFLOAT amplitudeContrast,    /**< [in] @f$A@f$ */
+         const RFLOAT phaseShift            /**< [in] @f$\Delta\varphi@f$ */
+         );
+
+/**
+ * @brief This function computes the CTF values of the pixels tabulated in a CTFGeometry under several defocus factors @f$d_k@f$, which scale @f$\Delta f_1@f$ and @f$\Delta f_2@f$, output in a float array @f$I@f$ of which the k-th row of @f$N@f$ values belongs to @f$d_k@f$.
+ *
+ * As @f$\chi@f$ is affine in @f$d_k@f$ for each pixel, its slope and intercept are computed in one pass over the pixels, after which each CTF only takes a multiply-add and a sine per pixel.
+ */
+void CTF(RFLOAT* dst,                       /**< [out] @f$I@f$ */
+         const CTFGeometry& geom,           /**< [in] geometry of the pixels */
+         const RFLOAT* d,                   /**< [in] @f$d_k@f$ */
+         const int nD,                      /**< [in] number of defocus factors */
+         const RFLOAT voltage,              /**< [in] @f$V@f$ */
+         const RFLOAT defocusU,             /**< [in] @f$\Delta f_1@f$ */
+         const RFLOAT defocusV,             /**< [in] @f$\Delta f_2@f$ */
+         const RFLOAT theta,                /**< [in] @f$\alpha{_{\alpha st}}@f$ */
+         const RFLOAT Cs,                   /**< [in] @f$C_S@f$ */
+         const RFLOAT amplitudeContrast,    /**< [in] @f$A@f$ */
+         const RFLOAT phaseShift            /**< [in] @f$\Delta\varphi@f$ */
+         );
+
 #endif // CTF_H
@@ -142,6 +142,19 @@
 
 //#define MODEL_DETERMINE_INCREASE_FSC
 
+/**
+ * compare two hemispheres by pairing processes of hemisphere A and B over
+ * slabs of Fourier space, instead of gathering both references in the master
+ * process, except for FSC in mask or core region which needs the whole maps
+ */
+#define MODEL_COMPARE_DISTRIBUTED
+
+/**
+ * keep one copy of the padded references of projectors per node and
+ * hemisphere in an MPI shared memory window, instead of one copy per process
+ */
+#define MODEL_SHARE_PROJECTOR
+
 #define OPTIMISER_CTF_ON_THE_FLY
 
 #define OPTIMISER_LOG_MEM_USAGE
@@ -197,6 +210,10 @@
 
 #define OPTIMISER_SIGMA_RANK1ST
 
+#if defined(OPTIMISER_NORM_CORRECTION) && defined(OPTIMISER_REFRESH_SIGMA) && defined(OPTIMISER_NORM_MASK) && defined(OPTIMISER_SIGMA_RANK1ST)
+#define OPTIMISER_NORM_SIGMA_ONE_PASS
+#endif
+
 //#define OPTIMISER_SIGMA_GRADING
 
 #define OPTIMISER_RECONSTRUCT_FREE_IMG_STACK_TO_SAVE_MEM
@@ -75,6 +75,7 @@
 #define FW_CLEAN_UP_MT(obj /**< [in, out] the // TODO */ \
                        ) \
 { \
+    _Pragma("omp critical (FFT_PLAN)") \
     TSFFTW_destroy_plan(fwPlan); \
     fwPlan = NULL; \
     _dstC = NULL; \
@@ -99,6 +100,7 @@
  */
 #define BW_CLEAN_UP_MT(obj /**< [in, out] the //TODO */) \
 { \
+    _Pragma("omp critical (FFT_PLAN)") \
     TSFFTW_destroy_plan(bwPlan); \
     bwPlan = NULL; \
     _dstR = NULL; \
@@ -324,6 +326,13 @@ class FFT
                            const unsigned int nThread   /**< [in] the number of threads to be used */
                            );
 
+        /**
+         * @brief This function executes the created plan that performs inverse Fourier transform from the Fourier space of src into the real space of dst, which should be allocated. The Fourier space of src is destroyed. It leaves this object untouched, thus several threads may execute the plan at the same time, provided that the plan is created with a single thread.
+         */
+        void bwExecutePlan(Image& dst,                  /**< [out] the image receiving the inverse Fourier transform */
+                           Image& src                   /**< [in] the image to be inverse Fourier transformed */
+                           ) const;
+
         /**
          * @brief This function destroys the created plan that performs Fourier transform on an image or volume.
          */
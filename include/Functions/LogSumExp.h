@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description: batched exponential and log-domain weight accumulation
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#ifndef LOG_SUM_EXP_H
+#define LOG_SUM_EXP_H
+
+#include <cmath>
+
+#include "Config.h"
+#include "Precision.h"
+
+/**
+ * @brief This function calculates the exponential of each element of an
+ * array.
+ *
+ * In single precision with SIMD enabled, it uses a Cephes-style range
+ * reduction and a degree-5 polynomial, 8 (AVX) or 16 (AVX512) elements at a
+ * time. Its relative error is below 2e-7 (about 2 ulp) for inputs in
+ * [-87.3, 88]. Inputs below -87.3 give 0 and inputs above 88 give exp(88).
+ * In double precision it falls back to exp().
+ */
+void vexp(RFLOAT* dst,       /**< [out] exponential of each element */
+          const RFLOAT* src, /**< [in] exponents */
+          const int n        /**< [in] number of elements */
+         );
+
+/**
+ * @brief This function returns the maximum of an array.
+ */
+RFLOAT vmax(const RFLOAT* src, /**< [in] array */
+            const int n        /**< [in] number of elements, at least 1 */
+           );
+
+/**
+ * @brief This function turns a block of log-likelihoods into weights relative
+ * to the maximum of the block, w[i] = exp(logW[i] - max), and returns the
+ * maximum.
+ */
+RFLOAT blockWeight(RFLOAT* w,          /**< [out] weights of the block */
+                   const RFLOAT* logW, /**< [in] log-likelihoods of the block */
+                   const int n         /**< [in] number of hypotheses in the block */
+                  );
+
+/**
+ * @brief This function merges the maximum of a block into the running base
+ * line of a log-domain weight accumulator. It returns the factor by which the
+ * weights accumulated so far have to be rescaled, and gives in scale the
+ * factor by which the weights of the block have to be multiplied before
+ * being accumulated. The base line starts as NaN.
+ */
+inline RFLOAT mergeBaseLine(RFLOAT& baseLine,     /**< [in,out] running base line */
+                            RFLOAT& scale,        /**< [out] factor of the block */
+                            const RFLOAT blockMax /**< [in] maximum of the block */
+                           )
+{
+    if (TSGSL_isnan(baseLine) || (blockMax > baseLine))
+    {
+        RFLOAT nf = TSGSL_isnan(baseLine) ? 1 : exp(baseLine - blockMax);
+
+        baseLine = blockMax;
+
+        scale = 1;
+
+        return nf;
+    }
+    else
+    {
+        scale = exp(blockMax - baseLine);
+
+        return 1;
+    }
+}
+
+#endif // LOG_SUM_EXP_H
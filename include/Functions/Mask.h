@@ -32,6 +32,18 @@
 
 #define GEN_MASK_GAP 0.05
 
+/**
+ * number of the largest connected components kept in a generated mask, 0 for
+ * keeping all of them
+ */
+#define GEN_MASK_N_COMPONENT 0
+
+/**
+ * minimum number of voxels of a connected component kept in a generated mask,
+ * 2 removes isolated voxels
+ */
+#define GEN_MASK_MIN_COMPONENT 2
+
 /**
  * This function calculates the number of pixels inside the circle of a certain radius.
  *
@@ -294,9 +306,40 @@ void regionBgSoftMask(Volume& dst,
                       const RFLOAT rL,
                       const unsigned int nThread);
 
+/**
+ * @brief This function calculates the square of the Euclidean distance of each voxel to the nearest voxel of a certain value.
+ *
+ * The distance is exact. It is calculated by a separable transform, which takes the lower envelope of parabolas along the columns, the rows and the slices in turn (Felzenszwalb and Huttenlocher), in linear time and in parallel over lines. The volume is not periodic, i.e. the distance is not wrapped around the boundary. A voxel gets FLT_MAX when no voxel has the value.
+ */
+void distanceTransform(Volume& dst,           /**< [out] square of the distance, in real space */
+                       const Volume& src,     /**< [in]  source volume in real space */
+                       const RFLOAT value,    /**< [in]  value of the voxels the distance is measured to */
+                       const unsigned int nThread /**< [in]  number of threads */
+                      );
+
 void removeIsolatedPoint(Volume& vol,
                          const unsigned int nThread);
 
+/**
+ * @brief This function labels the connected components of the voxels of value 1, two voxels being connected when they share a face. It returns the number of components.
+ *
+ * The volume is split into slabs of slices, each of which is labelled by union-find by a thread, and the slabs are then merged along their boundaries. The labels are numbered from 0 in the order of the first voxel of each component in memory. The volume is not periodic.
+ */
+int labelComponent(vector<int>& label,    /**< [out] label of each voxel, -1 for the voxels not of value 1 */
+                   vector<size_t>& size,  /**< [out] number of voxels of each component */
+                   const Volume& vol,     /**< [in]  volume in real space */
+                   const unsigned int nThread /**< [in]  number of threads */
+                  );
+
+/**
+ * @brief This function sets to 0 the voxels of the connected components of value 1 which are smaller than a minimum size or not among the largest ones.
+ */
+void filterComponent(Volume& vol,          /**< [in,out] volume in real space */
+                     const int nKeep,      /**< [in]  number of the largest components kept, 0 for all */
+                     const size_t minSize, /**< [in]  minimum number of voxels of a kept component */
+                     const unsigned int nThread /**< [in]  number of threads */
+                    );
+
 void extMask(Volume& vol,
              const RFLOAT ext,
              const unsigned int nThread);
@@ -323,6 +366,19 @@ void genMask(Volume& dst,
              const RFLOAT ew,
              const unsigned int nThread);
 
+/**
+ * @brief This function generates a mask by thresholding, keeping the connected components designated, extending and softening the edge.
+ */
+void genMask(Volume& dst,              /**< [out] mask */
+             const Volume& src,        /**< [in]  source volume */
+             const RFLOAT thres,       /**< [in]  threshold */
+             const RFLOAT ext,         /**< [in]  length of extending in pixel */
+             const RFLOAT ew,          /**< [in]  edge width in pixel */
+             const int nKeep,          /**< [in]  number of the largest components kept, 0 for all */
+             const size_t minSize,     /**< [in]  minimum number of voxels of a kept component */
+             const unsigned int nThread /**< [in]  number of threads */
+            );
+
 /**
  * This function generates a mask on a volume. The standard for generating mask is
  * that if the density of a voxel is larger than a threshold.
@@ -26,6 +26,55 @@
 #include "Logging.h"
 #include "Precision.h"
 
+/**
+ * @brief Philox4x32-10 counter-based random engine, exposed as a GSL random
+ * number generator type. Its output depends only on its key and counter, so
+ * that a stream can be positioned without generating the numbers before it.
+ */
+extern const gsl_rng_type* gsl_rng_philox4x32;
+
+/**
+ * @brief This function sets the global random seed. A non-zero seed switches
+ * every thread to a Philox4x32-10 engine and makes seed_random_engine()
+ * effective. A zero seed restores engines seeded from /dev/urandom.
+ */
+void set_random_seed(const unsigned long seed /**< [in] global random seed */);
+
+/**
+ * @brief This function returns the random engine of the calling thread.
+ */
 gsl_rng* get_random_engine();
 
+/**
+ * @brief This function positions the random engine of the calling thread at
+ * the beginning of the stream keyed on (global seed, iteration, ID, phase).
+ * The numbers drawn afterwards do not depend on which thread or process
+ * calls it. It does nothing if no global random seed is set.
+ */
+void seed_random_engine(const int iter,  /**< [in] iteration */
+                        const int id,    /**< [in] ID of the particle */
+                        const int phase  /**< [in] phase in the iteration */
+                       );
+
+/**
+ * @brief This function fills an array with uniform variates in [0, 1). Each
+ * Philox block yields four variates at once; other engines are drawn one by
+ * one in order.
+ */
+void random_uniform_batch(double* dst,           /**< [out] variates */
+                          const size_t n,        /**< [in] number of variates */
+                          const gsl_rng* engine  /**< [in] random engine */
+                         );
+
+/**
+ * @brief This function fills an array with Gaussian variates of zero mean.
+ * With a Philox engine the variates are generated in pairs by the Box-Muller
+ * transform, otherwise gsl_ran_gaussian() is called in order.
+ */
+void random_gaussian_batch(double* dst,           /**< [out] variates */
+                           const size_t n,        /**< [in] number of variates */
+                           const double sigma,    /**< [in] standard deviation */
+                           const gsl_rng* engine  /**< [in] random engine */
+                          );
+
 #endif // RANDOM_H
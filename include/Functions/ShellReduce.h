@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description: accumulation of per-voxel statistics of the positive half of
+ *              Fourier space into rings / shells
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#ifndef SHELL_REDUCE_H
+#define SHELL_REDUCE_H
+
+#include <cmath>
+
+#include "omp_compat.h"
+
+#include "Config.h"
+#include "Macro.h"
+#include "Typedef.h"
+#include "Precision.h"
+#include "Complex.h"
+
+/**
+ * @brief This function accumulates statistics of the voxels of the positive half of Fourier space into the shells they belong to, i.e. AROUND(NORM_3(i, j, k)), up to shell r (exclusive).
+ *
+ * The positive half of Fourier space is walked line by line, a line being a fixed row and slice. Along a line the shell index only grows, so the voxels of a line split into runs of the same shell. The bound of each run is found by integer arithmetic, without a square root per voxel. Each thread accumulates into its own histogram, and the histograms are summed at the end, so no atomic operation is needed.
+ *
+ * F is a functor with a static constant N, the number of statistics, and an operator (double* s, const size_t index) adding the N statistics of the voxel at index to s[0], ..., s[N - 1], where index counts from the first voxel of line lineBegin.
+ *
+ * The output holds the statistics of shell u at sum(n * r + u), 0 <= n < N, and the number of voxels in shell u at sum(N * r + u).
+ */
+template <class F>
+inline void shellReduce(dvec& sum,                          /**< [out] statistics and number of voxels of each shell */
+                        const F& f,                         /**< [in]  statistics of a voxel */
+                        const long nCol,                    /**< [in]  number of columns in real space */
+                        const long nRow,                    /**< [in]  number of rows */
+                        const long nSlc,                    /**< [in]  number of slices, 1 for an image */
+                        const int r,                        /**< [in]  number of shells */
+                        const unsigned int nThread,         /**< [in]  number of threads */
+                        const size_t lineBegin = 0,         /**< [in]  first line to be walked */
+                        const size_t lineEnd = (size_t)-1   /**< [in]  last line to be walked (exclusive), by default all lines */
+                       )
+{
+    long nColFT = nCol / 2 + 1;
+
+    size_t end = (lineEnd == (size_t)-1) ? (size_t)(nRow * nSlc) : lineEnd;
+
+    sum = dvec::Zero((F::N + 1) * r);
+
+    #pragma omp parallel num_threads(nThread)
+    {
+        dvec sumT = dvec::Zero((F::N + 1) * r);
+
+        double s[F::N];
+
+        #pragma omp for schedule(dynamic)
+        for (size_t line = lineBegin; line < end; line++)
+        {
+            long j = line % nRow;
+            long k = line / nRow;
+
+            j = (2 * j < nRow) ? j : j - nRow;
+            k = (2 * k < nSlc) ? k : k - nSlc;
+
+            long q = j * j + k * k;
+
+            // voxel of i belongs to shell u if and only if u * u - u < i * i + q <= u * u + u
+            long u = (long)sqrt((double)q);
+
+            while ((u > 0) && (q <= (u - 1) * (u - 1) + (u - 1))) u--;
+
+            size_t offset = (line - lineBegin) * nColFT;
+
+            long i = 0;
+
+            while (i < nColFT)
+            {
+                while (i * i + q > u * u + u) u++;
+
+                if (u >= r) break;
+
+                for (int n = 0; n < F::N; n++) s[n] = 0;
+
+                long i0 = i;
+
+                for (; (i < nColFT) && (i * i + q <= u * u + u); i++)
+                    f(s, offset + i);
+
+                for (int n = 0; n < F::N; n++) sumT(n * r + u) += s[n];
+
+                sumT(F::N * r + u) += i - i0;
+            }
+        }
+
+        #pragma omp critical (shellReduce)
+        sum += sumT;
+    }
+}
+
+/**
+ * @brief Sum of a real-valued volume.
+ */
+struct ShellSum
+{
+    static const int N = 1;
+
+    const RFLOAT* _src;
+
+    ShellSum(const RFLOAT* src) : _src(src) {}
+
+    inline void operator()(double* s, const size_t index) const
+    {
+        s[0] += _src[index];
+    }
+};
+
+/**
+ * @brief Sum of the modulus of a complex volume.
+ */
+struct ShellSumAbs
+{
+    static const int N = 1;
+
+    const Complex* _src;
+
+    ShellSumAbs(const Complex* src) : _src(src) {}
+
+    inline void operator()(double* s, const size_t index) const
+    {
+        s[0] += ABS(_src[index]);
+    }
+};
+
+/**
+ * @brief Sum of the power of a complex volume.
+ */
+struct ShellSumAbs2
+{
+    static const int N = 1;
+
+    const Complex* _src;
+
+    ShellSumAbs2(const Complex* src) : _src(src) {}
+
+    inline void operator()(double* s, const size_t index) const
+    {
+        s[0] += ABS2(_src[index]);
+    }
+};
+
+/**
+ * @brief Sums of @f$Re(AB^*)@f$, @f$|A|^2@f$ and @f$|B|^2@f$ of two complex volumes, as needed by FSC.
+ */
+struct ShellSumFSC
+{
+    static const int N = 3;
+
+    const Complex* _a;
+
+    const Complex* _b;
+
+    ShellSumFSC(const Complex* a,
+                const Complex* b) : _a(a), _b(b) {}
+
+    inline void operator()(double* s, const size_t index) const
+    {
+        Complex a = _a[index];
+        Complex b = _b[index];
+
+        s[0] += REAL(a) * REAL(b) + IMAG(a) * IMAG(b);
+        s[1] += ABS2(a);
+        s[2] += ABS2(b);
+    }
+};
+
+/**
+ * @brief Sums of ShellSumFSC of two pairs of complex volumes, so that two FSCs are calculated in one pass.
+ */
+struct ShellSumFSCPair
+{
+    static const int N = 6;
+
+    ShellSumFSC _ab;
+
+    ShellSumFSC _cd;
+
+    ShellSumFSCPair(const Complex* a,
+                    const Complex* b,
+                    const Complex* c,
+                    const Complex* d) : _ab(a, b), _cd(c, d) {}
+
+    inline void operator()(double* s, const size_t index) const
+    {
+        _ab(s, index);
+        _cd(s + 3, index);
+    }
+};
+
+/**
+ * @brief Sum of a function of a complex volume.
+ */
+template <class G>
+struct ShellSumFunc
+{
+    static const int N = 1;
+
+    const Complex* _src;
+
+    const G& _func;
+
+    ShellSumFunc(const Complex* src,
+                 const G& func) : _src(src), _func(func) {}
+
+    inline void operator()(double* s, const size_t index) const
+    {
+        s[0] += _func(_src[index]);
+    }
+};
+
+#endif // SHELL_REDUCE_H
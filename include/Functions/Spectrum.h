@@ -20,7 +20,9 @@
 
 #include "Image.h"
 #include "Volume.h"
+#include "RealFTVolume.h"
 #include "Filter.h"
+#include "ShellReduce.h"
 
 /**
  * This function returns the Nyquist resolution limit in Angstrom(-1).
@@ -104,6 +106,18 @@ void ringAverage(vec& dst,
                  const function<RFLOAT(const Complex)> func,
                  const int r);
 
+/**
+ * This function calculates the ring averages of a real-valued image in
+ * Fourier space within a given spatial frequency.
+ *
+ * @param dst ring averages
+ * @param src real-valued image in Fourier space
+ * @param r   upper boundary of spatial frequency in pixel
+ */
+void ringAverage(vec& dst,
+                 const RealFTVolume& src,
+                 const int r);
+
 /**
  * This function calculates the shell average at a certain resolution with a
  * given function.
@@ -124,6 +138,20 @@ void shellAverage(vec& dst,
                   const int r,
                   const unsigned int nThread);
 
+/**
+ * This function calculates the shell averages of a real-valued volume in
+ * Fourier space within a given spatial frequency.
+ *
+ * @param dst     shell averages
+ * @param src     real-valued volume in Fourier space
+ * @param r       upper boundary of spatial frequency in pixel
+ * @param nThread number of threads
+ */
+void shellAverage(vec& dst,
+                  const RealFTVolume& src,
+                  const int r,
+                  const unsigned int nThread);
+
 /**
  * This function calculates the power spectrum of a certain image within a
  * given spatial frequency.
@@ -182,6 +210,18 @@ void FSC(vec& dst,
          const Volume& B,
          const unsigned int nThread);
 
+/**
+ * @brief This function calculates the FSC between A and B and the FSC between C and D in one pass.
+ */
+void FSC(vec& dstAB,                /**< [out] FSC between A and B */
+         vec& dstCD,                /**< [out] FSC between C and D, of the same size as dstAB */
+         const Volume& A,           /**< [in]  volume in Fourier space */
+         const Volume& B,           /**< [in]  volume in Fourier space */
+         const Volume& C,           /**< [in]  volume in Fourier space */
+         const Volume& D,           /**< [in]  volume in Fourier space */
+         const unsigned int nThread /**< [in]  number of threads */
+        );
+
 /**
  * This function determines the resolution based on FSC given.
  *
@@ -61,6 +61,31 @@ void quaternion_mul(dvec4& dst,      /**< [out] product, a quaternion */
                     const dvec4& a,  /**< [in]  left multiplier, @f$\mathbf{q_1}@f$ */
                     const dvec4& b   /**< [in]  right multiplier, @f$\mathbf{q_2}@f$ */
                    );
+
+/**
+ * @brief Calculate the product of each row of a table of quaternions and a quaternion on its right side. Rows are processed column-wise, thus the loop is vectorised. It is safe to have dst aliasing a.
+ */
+void quaternion_mul(dmat4& dst,      /**< [out] products, each row storing a quaternion */
+                    const dmat4& a,  /**< [in]  left multipliers, each row storing a quaternion */
+                    const dvec4& b   /**< [in]  right multiplier, @f$\mathbf{q_2}@f$ */
+                   );
+
+/**
+ * @brief Calculate the product of a quaternion and each row of a table of quaternions on its right side. Rows are processed column-wise, thus the loop is vectorised. It is safe to have dst aliasing b.
+ */
+void quaternion_mul(dmat4& dst,      /**< [out] products, each row storing a quaternion */
+                    const dvec4& a,  /**< [in]  left multiplier, @f$\mathbf{q_1}@f$ */
+                    const dmat4& b   /**< [in]  right multipliers, each row storing a quaternion */
+                   );
+
+/**
+ * @brief Calculate the row-wise products of two tables of quaternions of the same size. Rows are processed column-wise, thus the loop is vectorised. It is safe to have dst aliasing a or b.
+ */
+void quaternion_mul(dmat4& dst,      /**< [out] products, each row storing a quaternion */
+                    const dmat4& a,  /**< [in]  left multipliers, each row storing a quaternion */
+                    const dmat4& b   /**< [in]  right multipliers, each row storing a quaternion */
+                   );
+
 /**
  * @brief Calculate the conjugate quaternion of a quaternion.
  *
@@ -269,6 +269,20 @@ void symmetryCounterpart(dvec4& dst,
                          const Symmetry& sym,
                          const dvec4* anchor = NULL);
 
+/**
+ * This function replaces each row of a table of quaternions by its symmetry
+ * counterpart closest to the anchor. It gives the same result as calling
+ * symmetryCounterpart() row by row, but loops over the symmetry elements only
+ * once for the whole table.
+ *
+ * @param dst    the table of quaternions, each row storing a quaternion
+ * @param sym    the symmetry
+ * @param anchor the anchor point
+ */
+void symmetryCounterpart(dmat4& dst,
+                         const Symmetry& sym,
+                         const dvec4* anchor = NULL);
+
 void symmetryRotation(vector<dmat33>& sr,
                       const dmat33 rot,
                       const Symmetry* sym = NULL);
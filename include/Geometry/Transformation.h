@@ -21,6 +21,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "Config.h"
 #include "Macro.h"
@@ -33,6 +34,7 @@
 
 #include "Image.h"
 #include "Volume.h"
+#include "RealFTVolume.h"
 
 #include "Symmetry.h"
 
@@ -162,10 +164,91 @@ inline void SYMMETRIZE_RL(Volume& dst,                   /**< [out] the symmetri
     dst.swap(result);
 }
 
+/**
+ * @brief The edge length of the cubic blocks in which SYMMETRIZE_FT gathers the symmetry images of the voxels.
+ */
+#define SYMMETRIZE_FT_BLOCK 8
+
+/**
+ * @brief Add the images of volume @f$V@f$ under all symmetry elements @f$\mathbf{S}@f$ in Fourier space onto @f$V@f$ itself, and output the sum in @f$V'@f$.
+ *
+ * The positive half of Fourier space is cut into cubic blocks, which are processed in parallel. In each block, the symmetry elements are applied one after another, so that the voxels interpolated from @f$V@f$ for one symmetry element stay in cache. Blocks beyond the radius only take the value of @f$V@f$.
+ */
+template <typename T, class V>
+inline void SYMMETRIZE_FT_GATHER(V& dst,                    /**< [out] the symmetrized volume @f$V'@f$, allocated with the size of @f$V@f$ */
+                                 const V& src,              /**< [in]  the original volume @f$V@f$ */
+                                 const Symmetry& sym,       /**< [in]  symmetry @f$\mathbf{S}@f$ */
+                                 const double r,            /**< [in]  the radius in Fourier space, restricts the transformed volume's range */
+                                 const int interp,          /**< [in]  the interpolation type */
+                                 const unsigned int nThread /**< [in]  the number of threads to be used */
+                                )
+{
+    std::vector<dmat33> R(sym.nSymmetryElement());
+
+    dmat33 L;
+
+    for (int s = 0; s < (int)R.size(); s++)
+        sym.get(L, R[s], s);
+
+    long nI = src.nColRL() / 2 + 1;
+    long nJ = src.nRowRL();
+    long nK = src.nSlcRL();
+
+    long nBI = (nI + SYMMETRIZE_FT_BLOCK - 1) / SYMMETRIZE_FT_BLOCK;
+    long nBJ = (nJ + SYMMETRIZE_FT_BLOCK - 1) / SYMMETRIZE_FT_BLOCK;
+    long nBK = (nK + SYMMETRIZE_FT_BLOCK - 1) / SYMMETRIZE_FT_BLOCK;
+
+    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
+    for (long b = 0; b < nBI * nBJ * nBK; b++)
+    {
+        long i0 = (b % nBI) * SYMMETRIZE_FT_BLOCK;
+        long j0 = (b / nBI % nBJ) * SYMMETRIZE_FT_BLOCK - nJ / 2;
+        long k0 = (b / nBI / nBJ) * SYMMETRIZE_FT_BLOCK - nK / 2;
+
+        long i1 = GSL_MIN_INT(i0 + SYMMETRIZE_FT_BLOCK, nI);
+        long j1 = GSL_MIN_INT(j0 + SYMMETRIZE_FT_BLOCK, nJ - nJ / 2);
+        long k1 = GSL_MIN_INT(k0 + SYMMETRIZE_FT_BLOCK, nK - nK / 2);
+
+        T value[SYMMETRIZE_FT_BLOCK][SYMMETRIZE_FT_BLOCK][SYMMETRIZE_FT_BLOCK];
+
+        for (long k = k0; k < k1; k++)
+            for (long j = j0; j < j1; j++)
+                for (long i = i0; i < i1; i++)
+                    value[k - k0][j - j0][i - i0] = src.getFTHalf(i, j, k);
+
+        // the distance between the block and the origin, rotations keep it
+        long di = i0;
+        long dj = (j0 > 0) ? j0 : ((j1 <= 0) ? j1 - 1 : 0);
+        long dk = (k0 > 0) ? k0 : ((k1 <= 0) ? k1 - 1 : 0);
+
+        if (QUAD_3(di, dj, dk) <= gsl_pow_2(r + 1))
+        {
+            for (int s = 0; s < (int)R.size(); s++)
+                for (long k = k0; k < k1; k++)
+                    for (long j = j0; j < j1; j++)
+                        for (long i = i0; i < i1; i++)
+                        {
+                            dvec3 oldCor = R[s] * dvec3((double)i, (double)j, (double)k);
+
+                            if (oldCor.squaredNorm() < gsl_pow_2(r))
+                                value[k - k0][j - j0][i - i0] += src.getByInterpolationFT(oldCor(0),
+                                                                                          oldCor(1),
+                                                                                          oldCor(2),
+                                                                                          interp);
+                        }
+        }
+
+        for (long k = k0; k < k1; k++)
+            for (long j = j0; j < j1; j++)
+                for (long i = i0; i < i1; i++)
+                    dst.setFTHalf(value[k - k0][j - j0][i - i0], i, j, k);
+    }
+}
+
 /**
  * @brief Symmetrize volume @f$V@f$ in Fourier space, given the symmetry elements @f$\mathbf{S} = \left\{\mathbf{s_0}, \mathbf{s_1}, \dots, \mathbf{s_{N - 1}}\right\}@f$, and output the symmetrized volume @f$V'@f$.
  * 
- * For volume @f$V@f$ in Fourier space, transform @f$\mathbf{V}@f$ by rotation matrix @f$s_i, 0 \leq i \leq N - 1@f$, respectively. Then sum the transformed matrices up.
+ * For volume @f$V@f$ in Fourier space, transform @f$\mathbf{V}@f$ by rotation matrix @f$s_i, 0 \leq i \leq N - 1@f$, respectively. Then sum the transformed matrices up. All symmetry elements are gathered in a single pass over @f$V'@f$, see SYMMETRIZE_FT_GATHER.
  */
 inline void SYMMETRIZE_FT(Volume& dst,                  /**< [out] the symmetrized volume @f$V'@f$ */
                           const Volume& src,            /**< [in]  the original volume @f$V@f$ */
@@ -175,20 +258,27 @@ inline void SYMMETRIZE_FT(Volume& dst,                  /**< [out] the symmetriz
                           const unsigned int nThread    /**< [in]  the number of threads to be used */
                          )
 {
-    Volume result = src.copyVolume();
+    Volume result(src.nColRL(), src.nRowRL(), src.nSlcRL(), FT_SPACE);
 
-    dmat33 L, R;
-    Volume se(src.nColRL(), src.nRowRL(), src.nSlcRL(), FT_SPACE);
+    SYMMETRIZE_FT_GATHER<Complex>(result, src, sym, r, interp, nThread);
 
-    for (int i = 0; i < sym.nSymmetryElement(); i++)
-    {
-        sym.get(L, R, i);
+    dst.swap(result);
+}
 
-        VOL_TRANSFORM_MAT_FT(se, src, R, r, interp, nThread);
+/**
+ * @brief Symmetrize a real-valued volume @f$V@f$ in Fourier space, given the symmetry elements @f$\mathbf{S}@f$, and output the symmetrized volume @f$V'@f$.
+ */
+inline void SYMMETRIZE_FT(RealFTVolume& dst,            /**< [out] the symmetrized volume @f$V'@f$ */
+                          const RealFTVolume& src,      /**< [in]  the original volume @f$V@f$ */
+                          const Symmetry& sym,          /**< [in]  symmetry @f$\mathbf{S}@f$ */
+                          const double r,               /**< [in]  the radius in Fourier space, restricts the transformed volume's range */
+                          const int interp,             /**< [in]  the interpolation type */
+                          const unsigned int nThread    /**< [in]  the number of threads to be used */
+                         )
+{
+    RealFTVolume result(src.nColRL(), src.nRowRL(), src.nSlcRL());
 
-        #pragma omp parallel for num_threads(nThread)
-        ADD_FT(result, se);
-    }
+    SYMMETRIZE_FT_GATHER<RFLOAT>(result, src, sym, r, interp, nThread);
 
     dst.swap(result);
 }
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description: queue of writing jobs executed in a thread of its own
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#ifndef ASYNC_WRITER_H
+#define ASYNC_WRITER_H
+
+#include <deque>
+
+#include <pthread.h>
+
+#include "Macro.h"
+#include "Logging.h"
+
+/**
+ * @brief The AsyncWriter class executes writing jobs in a thread of its own, so that files are written while the calculation goes on.
+ *
+ * A job is handed over by submit() and executed in the order of submission. The writer thread is started by the first submission. When it fails to start, the jobs are executed synchronously in submit(). submit() may be called by several threads at a time.
+ */
+class AsyncWriter
+{
+    public:
+
+        /**
+         * @brief A writing job. Whatever a job writes should be kept unchanged until it is executed.
+         */
+        struct Job
+        {
+            virtual ~Job() {}
+
+            virtual void write() = 0;
+        };
+
+    private:
+
+        /**
+         * submitted jobs not yet executed
+         */
+        std::deque<Job*> _queue;
+
+        /**
+         * number of submitted jobs not yet finished
+         */
+        int _nPending;
+
+        /**
+         * whether the writer thread is running
+         */
+        bool _running;
+
+        /**
+         * whether the writer thread is asked to stop after draining the queue
+         */
+        bool _stop;
+
+        pthread_mutex_t _mutex;
+
+        /**
+         * signalled when a job is submitted or the writer thread is asked to stop
+         */
+        pthread_cond_t _queueCond;
+
+        /**
+         * signalled when all submitted jobs are finished
+         */
+        pthread_cond_t _doneCond;
+
+        pthread_t _thread;
+
+        AsyncWriter(const AsyncWriter&);
+
+        AsyncWriter& operator=(const AsyncWriter&);
+
+    public:
+
+        AsyncWriter();
+
+        /**
+         * @brief Wait for all submitted jobs being finished and stop the writer thread.
+         */
+        ~AsyncWriter();
+
+        /**
+         * @brief Hand over a job, which is deleted after being executed.
+         */
+        void submit(Job* job /**< [in] job allocated by new */);
+
+        /**
+         * @brief Wait for all submitted jobs being finished.
+         */
+        void wait();
+
+    private:
+
+        static void* run(void* arg);
+};
+
+#endif // ASYNC_WRITER_H
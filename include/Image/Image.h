@@ -29,6 +29,7 @@
 #include "Precision.h"
 
 #include "Interpolation.h"
+#include "TabFunction.h"
 
 #include "ImageBase.h"
 #include "BMP.h"
@@ -359,6 +360,56 @@ class Image : public ImageBase
                                      const int interp   /**< [in] type of interpolation methods, (NEAREST_INTERP or LINEAR_INTERP) */
                                     ) const;
 
+        /**
+         * @brief This function gets the complex value of the irregular voxel in Fourier space by an interpolation method fixed at compilation, NEAREST_INTERP or LINEAR_INTERP.
+         *
+         * It is expanded in place of the caller. The four voxels around an irregular voxel are gathered directly, unless some of them lie across the boundary of the positive half.
+         *
+         * @return the complex value of an irregular voxel in Fourier space spce by interpolation methods
+         */
+        template <int interp>
+        inline Complex getByInterpolationFT(RFLOAT iCol,  /**< [in] index of the column (irregular voxel) of this image in Fourier space */
+                                            RFLOAT iRow   /**< [in] index of thr row (irregular voxel) of this image in Fourier space */
+                                           ) const
+        {
+            bool conj = conjHalf(iCol, iRow);
+
+            Complex result;
+
+            if (interp == NEAREST_INTERP)
+                result = getFTHalf(AROUND(iCol), AROUND(iRow));
+            else
+            {
+                RFLOAT w[2][2];
+                long x0[2];
+                RFLOAT x[2] = {iCol, iRow};
+
+                WG_BI_INTERP_LINEAR(w, x0, x);
+
+                if (x0[1] != -1)
+                {
+                    size_t index0 = iFTHalf(x0[0], x0[1]);
+
+                    result = COMPLEX(0, 0);
+
+                    for (int i = 0; i < 4; i++)
+                    {
+                        size_t index = index0 + ((const size_t*)_box)[i];
+
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+                        BOUNDARY_CHECK_FT(index);
+#endif
+
+                        result += _dataFT[index] * ((RFLOAT*)w)[i];
+                    }
+                }
+                else
+                    result = getFTHalf(w, x0);
+            }
+
+            return conj ? CONJUGATE(result) : result;
+        }
+
         /**
          * @brief This function adds the complex value to the certain irregular voxel in Fourier space.
          */
@@ -375,6 +426,16 @@ class Image : public ImageBase
                    RFLOAT iRow            /**< [in] index of the row (irregular voxel) of this image in Fourier space */
                   );
 
+        /**
+         * @brief This function adds the complex value to the certain irregular voxel in Fourier space by a certain kernel.
+         */
+        void addFT(const Complex value,      /**< [in] the complex value to add */
+                   const RFLOAT iCol,        /**< [in] index of the column (irregular voxel) of this image in Fourier space */
+                   const RFLOAT iRow,        /**< [in] index of the row (irregular voxel) of this image in Fourier space */
+                   const RFLOAT a,           /**< [in] radius of the blob */
+                   const TabFunction& kernel /**< [in] the kernel as a function of the square of radius */
+                  );
+
         /**
          * @brief Clear the Image object.
          */ 
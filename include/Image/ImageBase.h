@@ -229,6 +229,12 @@ class ImageBase
         RFLOAT* _dataRL;
 
         Complex* _dataFT;
+
+        /**
+         * whether _dataFT is allocated by this object or attached to a block
+         * of memory owned elsewhere, e.g., an MPI shared memory window
+         */
+        bool _ownFT;
 #endif
 
         size_t _sizeRL;
@@ -239,6 +245,9 @@ class ImageBase
 
         ImageBase(BOOST_RV_REF(ImageBase) that) : _dataRL(boost::move(that._dataRL)),
                                                   _dataFT(boost::move(that._dataFT)),
+#ifdef FFTW_PTR
+                                                  _ownFT(that._ownFT),
+#endif
                                                   _sizeRL(that._sizeRL),
                                                   _sizeFT(that._sizeFT)
         {
@@ -248,11 +257,20 @@ class ImageBase
 #ifdef FFTW_PTR
             that._dataRL = NULL;
             that._dataFT = NULL;
+            that._ownFT = true;
 #endif
         }
 
         ~ImageBase();
 
+#ifdef FFTW_PTR
+        /**
+         * release the space in Fourier space and point to a block of memory
+         * owned elsewhere instead, which will not be freed by this object
+         */
+        void attachFT(Complex* data);
+#endif
+
     public:
 
         void swap(ImageBase& that);
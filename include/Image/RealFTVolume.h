@@ -0,0 +1,276 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description: volume in Fourier space of which only the real part is
+ *              meaningful, such as the weights and the CTF sums during
+ *              reconstruction
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#ifndef REAL_FT_VOLUME_H
+#define REAL_FT_VOLUME_H
+
+#include <cmath>
+#include <cstring>
+
+#include <boost/move/core.hpp>
+
+#include "omp_compat.h"
+
+#include "Config.h"
+#include "Macro.h"
+#include "Typedef.h"
+#include "Precision.h"
+#include "Logging.h"
+#include "Functions.h"
+
+#include "ImageBase.h"
+#include "Interpolation.h"
+#include "TabFunction.h"
+
+/**
+ * @brief The RealFTVolume class stores the positive half of a volume in Fourier space holding real values only.
+ *
+ * It has the same layout as the Fourier space of a Volume (or an Image when the number of slices is 1), but stores a RFLOAT instead of a Complex for each voxel, which halves the memory footprint and the bandwidth. As the values are real, a voxel in the conjugate half has the same value as its counterpart in the positive half.
+ */
+class RealFTVolume
+{
+    BOOST_MOVABLE_BUT_NOT_COPYABLE(RealFTVolume)
+
+    private:
+
+        /**
+         * the values of the voxels
+         */
+        RFLOAT* _data;
+
+        /**
+         * number of voxels
+         */
+        size_t _size;
+
+        /**
+         * number of columns of the volume in real space
+         */
+        long _nCol;
+
+        /**
+         * number of rows of the volume
+         */
+        long _nRow;
+
+        /**
+         * number of slices of the volume
+         */
+        long _nSlc;
+
+        /**
+         * number of columns of the volume in Fourier space
+         */
+        long _nColFT;
+
+        /**
+         * the offsets between a voxel and its seven adjacent voxels, helpful for the interpolation
+         */
+        size_t _box[2][2][2];
+
+    public:
+
+        /**
+         * @brief Create an empty volume.
+         */
+        RealFTVolume();
+
+        /**
+         * @brief Create a volume of designated size in real space.
+         */
+        RealFTVolume(const long nCol, /**< [in] number of columns in real space */
+                     const long nRow, /**< [in] number of rows */
+                     const long nSlc  /**< [in] number of slices, 1 for an image */
+                    );
+
+        /**
+         * @brief Free the allocated space.
+         */
+        ~RealFTVolume();
+
+        /**
+         * @brief Exchange the content of this volume and that volume.
+         */
+        void swap(RealFTVolume& that);
+
+        /**
+         * @brief Allocate a volume of designated size in real space.
+         */
+        void alloc(const long nCol, /**< [in] number of columns in real space */
+                   const long nRow, /**< [in] number of rows */
+                   const long nSlc  /**< [in] number of slices, 1 for an image */
+                  );
+
+        /**
+         * @brief Free the allocated space and reset the size to 0.
+         */
+        void clear();
+
+        /**
+         * @brief Check whether the space is allocated or not.
+         */
+        inline bool isEmpty() const { return _data == NULL; };
+
+        inline long nColRL() const { return _nCol; };
+
+        inline long nRowRL() const { return _nRow; };
+
+        inline long nSlcRL() const { return _nSlc; };
+
+        inline long nColFT() const { return _nColFT; };
+
+        inline long nRowFT() const { return _nRow; };
+
+        inline long nSlcFT() const { return _nSlc; };
+
+        inline size_t sizeFT() const { return _size; };
+
+        inline RFLOAT* dataFT() { return _data; };
+
+        inline const RFLOAT* dataFT() const { return _data; };
+
+        /**
+         * @brief Return the i-th voxel.
+         */
+        inline RFLOAT& operator[](const size_t i)
+        {
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+            if (i >= _size) REPORT_ERROR("OUT OF BOUNDARY FT");
+#endif
+
+            return _data[i];
+        };
+
+        /**
+         * @brief Return the i-th voxel.
+         */
+        inline const RFLOAT& operator[](const size_t i) const
+        {
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+            if (i >= _size) REPORT_ERROR("OUT OF BOUNDARY FT");
+#endif
+
+            return _data[i];
+        };
+
+        /**
+         * @brief Compute the index of a regular voxel in the positive half.
+         */
+        inline size_t iFTHalf(const long i,    /**< [in] column index, non-negative */
+                              const long j,    /**< [in] row index */
+                              const long k = 0 /**< [in] slice index */
+                             ) const
+        {
+            return (k >= 0 ? k : k + _nSlc) * _nColFT * _nRow
+                 + (j >= 0 ? j : j + _nRow) * _nColFT
+                 + i;
+        };
+
+        /**
+         * @brief Compute the index of a regular voxel in the whole Fourier space.
+         */
+        inline size_t iFT(const long i,    /**< [in] column index */
+                          const long j,    /**< [in] row index */
+                          const long k = 0 /**< [in] slice index */
+                         ) const
+        {
+            return (i >= 0) ? iFTHalf(i, j, k) : iFTHalf(-i, -j, -k);
+        };
+
+        inline RFLOAT getFTHalf(const long i,
+                                const long j,
+                                const long k = 0) const
+        {
+            return (*this)[iFTHalf(i, j, k)];
+        };
+
+        inline void setFTHalf(const RFLOAT value,
+                              const long i,
+                              const long j,
+                              const long k = 0)
+        {
+            (*this)[iFTHalf(i, j, k)] = value;
+        };
+
+        /**
+         * @brief Add a value on a regular voxel in Fourier space atomically.
+         */
+        void addFT(const RFLOAT value, /**< [in] value to be added */
+                   const long iCol,    /**< [in] column index of the regular voxel */
+                   const long iRow,    /**< [in] row index of the regular voxel */
+                   const long iSlc = 0 /**< [in] slice index of the regular voxel */
+                  );
+
+        /**
+         * @brief Return the value of an irregular voxel in Fourier space by trilinear interpolation.
+         */
+        RFLOAT getByInterpolationFT(RFLOAT iCol,     /**< [in] column index of the irregular voxel */
+                                    RFLOAT iRow,     /**< [in] row index of the irregular voxel */
+                                    RFLOAT iSlc,     /**< [in] slice index of the irregular voxel */
+                                    const int interp /**< [in] NEAREST_INTERP or LINEAR_INTERP */
+                                   ) const;
+
+        /**
+         * @brief Add a value on an irregular pixel in Fourier space of an image by bilinear interpolation.
+         */
+        void addFT(const RFLOAT value, /**< [in] value to be added */
+                   RFLOAT iCol,        /**< [in] column index of the irregular pixel */
+                   RFLOAT iRow         /**< [in] row index of the irregular pixel */
+                  );
+
+        /**
+         * @brief Add a value on an irregular voxel in Fourier space by trilinear interpolation.
+         */
+        void addFT(const RFLOAT value, /**< [in] value to be added */
+                   RFLOAT iCol,        /**< [in] column index of the irregular voxel */
+                   RFLOAT iRow,        /**< [in] row index of the irregular voxel */
+                   RFLOAT iSlc         /**< [in] slice index of the irregular voxel */
+                  );
+
+        /**
+         * @brief Add a value on an irregular pixel in Fourier space of an image by a certain kernel.
+         */
+        void addFT(const RFLOAT value,       /**< [in] value to be added */
+                   const RFLOAT iCol,        /**< [in] column index of the irregular pixel */
+                   const RFLOAT iRow,        /**< [in] row index of the irregular pixel */
+                   const RFLOAT a,           /**< [in] radius of the blob */
+                   const TabFunction& kernel /**< [in] the kernel as a function of the square of radius */
+                  );
+
+        /**
+         * @brief Add a value on an irregular voxel in Fourier space by a certain kernel.
+         */
+        void addFT(const RFLOAT value,       /**< [in] value to be added */
+                   const RFLOAT iCol,        /**< [in] column index of the irregular voxel */
+                   const RFLOAT iRow,        /**< [in] row index of the irregular voxel */
+                   const RFLOAT iSlc,        /**< [in] slice index of the irregular voxel */
+                   const RFLOAT a,           /**< [in] radius of the blob */
+                   const TabFunction& kernel /**< [in] the kernel as a function of the square of radius */
+                  );
+
+    private:
+
+        void initBox();
+
+        RFLOAT getFTHalf(const RFLOAT w[2][2][2],
+                         const long x0[3]) const;
+
+        void addFTHalf(const RFLOAT value,
+                       const RFLOAT w[2][2],
+                       const long x0[2]);
+
+        void addFTHalf(const RFLOAT value,
+                       const RFLOAT w[2][2][2],
+                       const long x0[3]);
+};
+
+#endif // REAL_FT_VOLUME_H
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description: bounded asynchronous writer of the images of a stack
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#ifndef STACK_WRITER_H
+#define STACK_WRITER_H
+
+#include <vector>
+
+#include <pthread.h>
+
+#include "Image.h"
+#include "ImageFile.h"
+#include "AsyncWriter.h"
+
+/**
+ * @brief The StackWriter class writes images into an opened stack in a thread of its own.
+ *
+ * It owns a fixed number of image slots in real space. A producer takes a free slot by acquire(), which blocks until one is available, fills the image of the slot and hands it over by submit(), together with the index of the image in the stack. The submitted images are written by an AsyncWriter in the order of submission, which returns their slots. Thus at most the number of slots of images are held in memory, however fast the producers are. acquire() and submit() may be called by several threads at a time.
+ */
+class StackWriter
+{
+    private:
+
+        /**
+         * the stack written into, which should be opened by openStack()
+         */
+        ImageFile* _imf;
+
+        /**
+         * number of slots
+         */
+        int _nSlot;
+
+        /**
+         * images of the slots
+         */
+        Image* _slot;
+
+        /**
+         * free slots
+         */
+        std::vector<int> _free;
+
+        pthread_mutex_t _mutex;
+
+        /**
+         * signalled when a slot is returned
+         */
+        pthread_cond_t _freeCond;
+
+        /**
+         * writer of the submitted images
+         */
+        AsyncWriter _writer;
+
+        struct SlotWriting;
+
+    public:
+
+        /**
+         * @brief Allocate a number of slots, each of which holds an image of designated size.
+         */
+        StackWriter(ImageFile& imf,   /**< [in] stack opened by openStack() */
+                    const int nSlot,  /**< [in] number of slots */
+                    const int size    /**< [in] number of columns and rows of an image */
+                   );
+
+        /**
+         * @brief Wait for all submitted images being written and free the slots.
+         */
+        ~StackWriter();
+
+        /**
+         * @brief Take a free slot, waiting until one is available, and return its index.
+         */
+        int acquire();
+
+        /**
+         * @brief Return the image of a slot.
+         */
+        inline Image& image(const int slot) { return _slot[slot]; };
+
+        /**
+         * @brief Hand over the image of a slot for being written as the iSlc-th image of the stack.
+         */
+        void submit(const int slot, /**< [in] index of the slot */
+                    const int iSlc  /**< [in] index of the image in the stack */
+                   );
+
+        /**
+         * @brief Wait for all submitted images being written.
+         */
+        void finish();
+};
+
+#endif // STACK_WRITER_H
@@ -261,6 +261,17 @@ class Volume : public ImageBase
                    const int space /**< [in] the space this volume allocating, where RL_SPACE stands for the real space and FT_SPACE stands for the Fourier space */
                   );
 
+#ifdef FFTW_PTR
+        /**
+         * @brief Use a block of memory owned elsewhere, e.g., an MPI shared memory window, as the Fourier space of this volume. The memory will not be freed by this volume.
+         */
+        void attachFT(Complex* data, /**< [in] the Fourier space of this volume, (nCol / 2 + 1) x nRow x nSlc */
+                      const long nCol, /**< [in] number of columns of this volume */
+                      const long nRow, /**< [in] number of rows of this volume */
+                      const long nSlc /**< [in] number of slices of this volume */
+                     );
+#endif
+
         /**
          * @brief Return the number of columns of this volume in real space.
          *
@@ -445,6 +456,58 @@ class Volume : public ImageBase
                                      const int interp /**< [in] indicator of the type of interpolation, where INTERP_NEAREST stands for the nearest point interpolation, INTERP_LINEAR stands for the trilinear interpolation and INTERP_SINC stands for the sinc interpolation */
                                     ) const;
 
+        /**
+         * @brief Return the value of an irregular(non-grid) voxel in Fourier space by an interpolation fixed at compilation, NEAREST_INTERP or LINEAR_INTERP.
+         *
+         * It is expanded in place of the caller. The eight voxels around an irregular voxel are gathered directly, unless some of them lie across the boundary of the positive half.
+         *
+         * @return the value of an irregular(non-grid) voxel in Fourier spce by interpolation.
+         */
+        template <int interp>
+        inline Complex getByInterpolationFT(RFLOAT iCol, /**< [in] column index of the irregular voxel in Fourier space */
+                                            RFLOAT iRow, /**< [in] row index of the irregular voxel in Fourier space */
+                                            RFLOAT iSlc  /**< [in] slice index of the irregular voxel in Fourier space */
+                                           ) const
+        {
+            bool conj = conjHalf(iCol, iRow, iSlc);
+
+            Complex result;
+
+            if (interp == NEAREST_INTERP)
+                result = getFTHalf(AROUND(iCol), AROUND(iRow), AROUND(iSlc));
+            else
+            {
+                RFLOAT w[2][2][2];
+                long x0[3];
+                RFLOAT x[3] = {iCol, iRow, iSlc};
+
+                WG_TRI_INTERP_LINEAR(w, x0, x);
+
+                if ((x0[1] != -1) &&
+                    (x0[2] != -1))
+                {
+                    size_t index0 = iFTHalf(x0[0], x0[1], x0[2]);
+
+                    result = COMPLEX(0, 0);
+
+                    for (int i = 0; i < 8; i++)
+                    {
+                        size_t index = index0 + ((const size_t*)_box)[i];
+
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+                        BOUNDARY_CHECK_FT(index);
+#endif
+
+                        result += _dataFT[index] * ((RFLOAT*)w)[i];
+                    }
+                }
+                else
+                    result = getFTHalf(w, x0);
+            }
+
+            return conj ? CONJUGATE(result) : result;
+        }
+
         /**
          * @brief Add a certain complex value on the irregular(non-grid) voxel in Fourier space at given coordinates.
          */
@@ -168,6 +168,20 @@ class Model : public Parallel
          */
         boost::container::vector<Projector> _proj;
 
+#ifdef MODEL_SHARE_PROJECTOR
+        /**
+         * communicator of the processes of the same hemisphere on the same
+         * node
+         */
+        MPI_Comm _node;
+
+        /**
+         * MPI shared memory window holding the padded references of all
+         * projectors, one copy per node and hemisphere
+         */
+        MPI_Win _projWin;
+#endif
+
         /**
          * reconstructors
          */
@@ -365,6 +379,10 @@ class Model : public Parallel
             _sym = NULL;
             _searchType = SEARCH_TYPE_GLOBAL;
             _increaseR = false;
+#ifdef MODEL_SHARE_PROJECTOR
+            _node = MPI_COMM_NULL;
+            _projWin = MPI_WIN_NULL;
+#endif
         }
 
         /**
@@ -555,6 +573,21 @@ class Model : public Parallel
                                    const RFLOAT thres,
                                    const unsigned int nThread);
 
+#ifdef MODEL_COMPARE_DISTRIBUTED
+        /**
+         * This function compares two hemispheres without gathering the
+         * references in the MASTER process. The i-th process of hemisphere A
+         * and the i-th process of hemisphere B exchange a slab of the
+         * references in Fourier space, and the per-shell sums of FSC are
+         * reduced among all processes. When averaging, each pair averages its
+         * slab, and the slabs are broadcast in each hemisphere.
+         */
+        void compareTwoHemispheresDist(const bool fscFlag,
+                                       const bool avgFlag,
+                                       const RFLOAT thres,
+                                       const unsigned int nThread);
+#endif
+
         /**
          * This function performs a low pass filter on each reference.
          * 
@@ -674,6 +707,16 @@ class Model : public Parallel
          */
         void refreshProj(const unsigned int nThread);
 
+#ifdef MODEL_SHARE_PROJECTOR
+        /**
+         * This function refreshs the projectors of 3D references, keeping one
+         * copy of the padded references per node and hemisphere. The first
+         * process of each node pads the references into an MPI shared memory
+         * window, and the other processes project from it read-only.
+         */
+        void refreshProjShared(const unsigned int nThread);
+#endif
+
         /**
          * This function refreshs the reconstructors by resetting the size,
          * padding factor, symmetry information, MKB kernel parameters,
@@ -851,6 +894,9 @@ class Model : public Parallel
 
         /**
          * This function clears up references, projectors and reconstructors.
+         * With shared projectors, it also frees the shared memory window and
+         * the node communicator, so it must be called by all processes of the
+         * node before MPI_Finalize.
          */
         void clear();
 
@@ -17,6 +17,7 @@
 #include <climits>
 #include <queue>
 #include <functional>
+#include <vector>
 
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_statistics.h>
@@ -32,6 +33,7 @@
 #include "Image.h"
 #include "Volume.h"
 #include "ImageFile.h"
+#include "StackWriter.h"
 #include "Spectrum.h"
 #include "Symmetry.h"
 #include "CTF.h"
@@ -39,6 +41,7 @@
 #include "Particle.h"
 #include "Database.h"
 #include "Model.h"
+#include "LogSumExp.h"
 
 #ifdef GPU_VERSION
 #include "Interface.h"
@@ -57,13 +60,56 @@
 #define MIN_N_PHASE_PER_ITER_LOCAL 3
 #define MAX_N_PHASE_PER_ITER 100
 
+/**
+ * phases of the random streams of a particle drawn outside the particle
+ * filter, after the phases of the particle filter, so that they do not
+ * overlap; the insertion of class t in the GPU version draws from phase
+ * RANDOM_PHASE_INSERT + 1 + t
+ */
+#define RANDOM_PHASE_CLASS_DISTR MAX_N_PHASE_PER_ITER
+#define RANDOM_PHASE_VARIANCE (MAX_N_PHASE_PER_ITER + 1)
+#define RANDOM_PHASE_SIGMA (MAX_N_PHASE_PER_ITER + 2)
+#define RANDOM_PHASE_INSERT (MAX_N_PHASE_PER_ITER + 3)
+
 #define PARTICLE_FILTER_DECREASE_FACTOR 0.95
 #define PARTICLE_FILTER_INCREASE_FACTOR 1.05
 
 #define N_PHASE_WITH_NO_VARI_DECREASE 1
 
+/**
+ * In local search, when freezing converged particles is enabled, the particle
+ * filter of an image is skipped if, in the last expectation, its most likely
+ * rotation changed by less than FREEZE_THRES_ROT_CHANGE (1 - |q0 * q1|), its
+ * most likely translation changed by less than FREEZE_THRES_TRANS_CHANGE
+ * pixels, and the cutoff frequency did not grow. An image is never skipped in
+ * more than FREEZE_MAX_N_ITER continuous iterations.
+ */
+#define FREEZE_THRES_ROT_CHANGE 1e-5
+#define FREEZE_THRES_TRANS_CHANGE 0.25
+#define FREEZE_MAX_N_ITER 2
+
 #define N_SAVE_IMG 20 
 
+/**
+ * number of images buffered per thread for the stack writer of the subtracted
+ * images
+ */
+#define SUBTRACT_N_SLOT_PER_THREAD 4
+
+/**
+ * number of translations whose log-likelihoods are buffered per image before
+ * being merged into the weights in the scanning phase of global search
+ */
+#define N_WEIGHT_BLOCK_GLOBAL 16
+
+/**
+ * kinds of the soft mask weights cached for solvent flatten and reference
+ * masking
+ */
+#define SOLVENT_WEIGHT_NONE -1
+#define SOLVENT_WEIGHT_SPHERE 0
+#define SOLVENT_WEIGHT_MASK 1
+
 #define TRANS_Q 0.05
 
 #define MIN_STD_FACTOR 1
@@ -74,6 +120,13 @@
 
 #define AVERAGE_TWO_HEMISPHERE_THRES 0.95
 
+/**
+ * number of voxels of a padded reference worth a thread during
+ * reconstruction, it decides how many classes are reconstructed
+ * concurrently, and the threads of a process are shared evenly by them
+ */
+#define RECONSTRUCT_N_VOXEL_PER_THREAD (1 << 22)
+
 struct OptimiserPara
 {
 
@@ -379,6 +432,64 @@ struct OptimiserPara
 
     RFLOAT perturbFactorSCTF;
 
+#define KEY_RANDOM_SEED "Random Seed"
+
+    /**
+     * seed of the counter-based random engines, 0 for seeding from the
+     * system, otherwise runs are reproducible at any number of processes and
+     * threads
+     */
+    int randomSeed;
+
+#define KEY_MASTER_SHARE_NODE "Master Shares Node"
+
+    /**
+     * whether the master process shares a node with a worker process or not,
+     * if so, the master process sleeps instead of busy waiting while the
+     * workers perform expectation and reconstruction
+     */
+    bool masterShareNode;
+
+#define KEY_FREEZE_CONVERGED "Freeze Converged Particles"
+
+    /**
+     * whether skipping the particle filter of converged images in local
+     * search or not
+     */
+    bool freezeConverged;
+
+#define KEY_SYM_INSERT "Symmetry Expanded Insertion"
+
+    /**
+     * whether inserting each image under all symmetry related rotations
+     * instead of symmetrizing the reconstructors after insertion or not
+     */
+    bool symInsert;
+
+#define KEY_MKB_INSERT "MKB Kernel Insertion"
+
+    /**
+     * whether inserting images by the kernel of Modified Kaiser Bessel
+     * Function instead of the trilinear one or not
+     */
+    bool mkbInsert;
+
+#define KEY_SAVE_IMG_ITER_INTERVAL "Saving Images Iteration Interval"
+
+    /**
+     * number of iterations between two savings of the best projections and
+     * their differences against the images, if enabled at compilation
+     */
+    int saveImgIterInterval;
+
+#define KEY_SAVE_IMG_STRIDE "Saving Images Stride"
+
+    /**
+     * the images of ID 0, stride, 2 * stride, ... are sampled for saving the
+     * best projections and the images, at most N_SAVE_IMG of them
+     */
+    int saveImgStride;
+
 #define KEY_SKIP_E "Skip Expectation"
 
     /**
@@ -442,6 +553,13 @@ struct OptimiserPara
         perturbFactorSGlobal = 0.8;
         perturbFactorSLocal = 0.8;
         perturbFactorSCTF = 0.8;
+        randomSeed = 0;
+        freezeConverged = false;
+        symInsert = false;
+        mkbInsert = (RECONSTRUCTOR_KERNEL_DEFAULT == RECONSTRUCTOR_KERNEL_MKB);
+        saveImgIterInterval = 1;
+        saveImgStride = 1;
+        masterShareNode = false;
         ctfRefineS = 0.01;
         skipE = false;
         skipM = false;
@@ -650,6 +768,41 @@ class Optimiser : public Parallel
          */
         int _nI;
 
+        /**
+         * change of the most likely rotation of each image in the last
+         * expectation
+         */
+        vector<double> _topRChange;
+
+        /**
+         * change of the most likely translation of each image in the last
+         * expectation
+         */
+        vector<double> _topTChange;
+
+        /**
+         * number of continuous iterations in which the particle filter of each
+         * image is skipped
+         */
+        vector<int> _nFrozen;
+
+        /**
+         * number of images whose particle filter is skipped in an iteration
+         * of a process
+         */
+        int _nSkip;
+
+        /**
+         * cutoff frequency of the last expectation
+         */
+        int _rLastE;
+
+        /**
+         * wall time (in seconds) of the particle filter of each image in the
+         * last expectation
+         */
+        vector<double> _costE;
+
         /**
          * number of performed rotations in the scanning phase of the global
          * search stage
@@ -670,10 +823,21 @@ class Optimiser : public Parallel
 
         int* _iRowPad;
 
+        /**
+         * geometry of the pixels in _iCol and _iRow for evaluating CTFs
+         */
+        CTFGeometry _ctfGeom;
+
         Complex* _datP;
 
         RFLOAT* _ctfP;
 
+        /**
+         * index of the CTF of each image in _ctfP; in image-major order on
+         * CPU, images sharing the same CTF attributes share one CTF
+         */
+        int* _iCtfP;
+
         RFLOAT* _sigP;
 
         RFLOAT* _sigRcpP;
@@ -700,6 +864,33 @@ class Optimiser : public Parallel
 
         FFT _fftImg;
 
+        /**
+         * plans of Fourier transforms of references, created once
+         */
+        FFT _fftRef;
+
+        /**
+         * soft mask weights of solvent flatten or reference masking, cached
+         * over iterations
+         */
+        Volume _solventWeight;
+
+        /**
+         * kind of the cached soft mask weights
+         */
+        int _solventWeightKind;
+
+        /**
+         * frequency at which the cached weights of the provided mask are low
+         * pass filtered
+         */
+        int _solventWeightR;
+
+        /**
+         * writer saving images as BMP files in background
+         */
+        AsyncWriter _bmpWriter;
+
         vec3 _regionCentre;
 
     public:
@@ -714,6 +905,11 @@ class Optimiser : public Parallel
             _nF = 0;
             _nI = 0;
             _nR = 0;
+            _nSkip = 0;
+            _rLastE = 0;
+
+            _solventWeightKind = SOLVENT_WEIGHT_NONE;
+            _solventWeightR = 0;
 
             _searchType = SEARCH_TYPE_GLOBAL;
 
@@ -727,6 +923,7 @@ class Optimiser : public Parallel
 
             _datP = NULL;
             _ctfP = NULL;
+            _iCtfP = NULL;
             _sigRcpP = NULL;
         }
 
@@ -752,6 +949,19 @@ class Optimiser : public Parallel
 
         void run();
 
+        /**
+         * This function waits for all processes. When the master process
+         * shares a node with a worker, it sleeps instead of busy waiting.
+         * Every world barrier of the optimiser goes through it, so that all
+         * processes always enter the same kind of barrier.
+         */
+        void waitAll();
+
+        /**
+         * This function frees the images, the particles, the CTFs and the
+         * model. It should be called before MPI_Finalize, as the model may
+         * hold MPI resources.
+         */
         void clear();
 
     private:
@@ -766,6 +976,18 @@ class Optimiser : public Parallel
          */
         void allReduceN();
 
+        /**
+         * number of threads used for reconstructing a class, the threads of
+         * the process shared evenly by the classes reconstructed concurrently
+         */
+        int nThreadReco() const;
+
+        /**
+         * number of classes reconstructed concurrently, limited by the number
+         * of classes and by the threads each class is worth
+         */
+        int nConcReco() const;
+
         /**
          * the size of the image
          */
@@ -925,6 +1147,27 @@ class Optimiser : public Parallel
                             const bool group);
         ***/
 
+#ifdef OPTIMISER_NORM_SIGMA_ONE_PASS
+        /**
+         * perform norm correction and re-calculate sigma in one sweep over
+         * images, projecting the best pose of each image only once
+         *
+         * @param norm  whether performing norm correction or not
+         * @param group grouping or not
+         */
+        void normSigmaOnePass(const bool norm,
+                              const bool group);
+#endif
+
+        /**
+         * average sigma of images over the hemisphere and refresh sigma of
+         * each group
+         */
+        void reduceSigma(mat& sigM,
+                         mat& sigN,
+                         const int rSig,
+                         const bool group);
+
         /**
          * reconstruct reference
          */
@@ -942,6 +1185,14 @@ class Optimiser : public Parallel
          */
         void solventFlatten(const bool mask = true);
 
+        /**
+         * @brief Return the soft mask weights of solvent flatten, or of
+         * reference masking when mask is set. The weights are rebuilt only
+         * when their kind, or the frequency at which the provided mask is low
+         * pass filtered, changes.
+         */
+        const Volume& solventWeight(const bool mask);
+
         void allocPreCalIdx(const RFLOAT rU,
                             const RFLOAT rL);
 
@@ -968,6 +1219,18 @@ class Optimiser : public Parallel
          */
         void saveImages();
 
+        /**
+         * @brief Return whether the image of a certain ID is sampled for
+         * saving the best projections and the images or not.
+         */
+        bool isSavedImage(const int id) const;
+
+        /**
+         * @brief Wait for the BMP files being saved in background to be
+         * written.
+         */
+        void waitSavingBMP();
+
         /**
          * for debug, save the CTFs
          */
@@ -26,6 +26,7 @@
 #define PARALLEL_H
 
 #include <cstdio>
+#include <deque>
 #include <mpi.h>
 #include "Logging.h"
 #include "Precision.h"
@@ -36,6 +37,16 @@
  */
 #define MPI_MAX_BUF 2000000000
 
+/**
+ * @brief the size (in bytes) of a chunk of MPI_Iallreduce_Large, small enough for pipelining and dividable by 2, 4, 8 and 16
+ */
+#define MPI_PIPELINE_BUF 67108864
+
+/**
+ * @brief the maximum number of chunks of MPI_Iallreduce_Large in flight at the same time
+ */
+#define MPI_PIPELINE_N_IN_FLIGHT 4
+
 /**
  * @brief process ID of master process
  */
@@ -51,6 +62,11 @@
  */
 #define HEMI_B_LEAD 2
 
+/**
+ * @brief interval (in microseconds) between two polls of MPI_Barrier_Lazy
+ */
+#define MPI_LAZY_POLL_INTERVAL 1000
+
 /**
  * @brief This macro is a short hand of a condition statement that the current process is the master process.
  */
@@ -251,6 +267,13 @@ void MPI_Ssend_Large(const void *buf,       /**< [in] the data elements to be se
                      MPI_Comm comm          /**< [in] the communicator that the sending/receiving processes belongs to. */
                     );
 
+/**
+ * @brief This function blocks until all processes in the communicator reach it, as MPI_Barrier, but sleeps between polls instead of busy waiting, leaving the core to the other processes on the same node. As a different collective operation, it can not be matched with MPI_Barrier.
+ */
+void MPI_Barrier_Lazy(MPI_Comm comm,                               /**< [in] the communicator */
+                      const int interval = MPI_LAZY_POLL_INTERVAL  /**< [in] interval between two polls in microseconds */
+                     );
+
 /**
  * @brief  This function can be used for broadcasting large size(>2GB) data
  */
@@ -276,4 +299,59 @@ void MPI_Allreduce_Large(void *buf,             /**< [in] the data buffer used f
                          MPI_Comm comm        /**< [in] the communicator that the all reducing processes belongs to. */
                         );
 
+/**
+ * @brief This structure keeps the state of an asynchronous all reducing of large size data, which is started by MPI_Iallreduce_Large and completed by MPI_Wait_Large.
+ */
+struct MPI_Request_Large
+{
+    /**
+     * @brief the first element of the chunks not started yet
+     */
+    char* ptr;
+
+    /**
+     * @brief the number of elements not started yet
+     */
+    size_t nLeft;
+
+    /**
+     * @brief the number of elements in a chunk
+     */
+    int chunk;
+
+    /**
+     * @brief the size of an element in bytes
+     */
+    int dataTypeSize;
+
+    MPI_Datatype datatype;
+
+    MPI_Op op;
+
+    MPI_Comm comm;
+
+    /**
+     * @brief requests of the chunks in flight, the earliest first
+     */
+    std::deque<MPI_Request> requests;
+
+    MPI_Request_Large() : ptr(NULL), nLeft(0), chunk(0), dataTypeSize(0) {}
+};
+
+/**
+ * @brief This function starts an in-place all reducing of large size(>2GB) data without blocking. The data is split into chunks of MPI_PIPELINE_BUF bytes, at most MPI_PIPELINE_N_IN_FLIGHT of which are reduced at the same time, and the following chunks are started in MPI_Wait_Large. The buffer must not be touched until MPI_Wait_Large returns. As other non-blocking collective operations, all processes of the communicator must start and wait all reducings in the same order.
+ */
+void MPI_Iallreduce_Large(void *buf,                    /**< [in] the data buffer used for saving all reducing result. */
+                          size_t count,                 /**< [in] the number of data elements to be reduced. */
+                          MPI_Datatype datatype,        /**< [in] the type of the  data elements to be reduced. */
+                          MPI_Op op,                    /**< [in] the operation to be performed in all reducing */
+                          MPI_Comm comm,                /**< [in] the communicator that the all reducing processes belongs to. */
+                          MPI_Request_Large& request    /**< [out] the handle of the all reducing */
+                         );
+
+/**
+ * @brief This function blocks until an all reducing started by MPI_Iallreduce_Large completes.
+ */
+void MPI_Wait_Large(MPI_Request_Large& request  /**< [in] the handle of the all reducing */);
+
 #endif // PARALLEL_H
@@ -9,6 +9,8 @@
 #ifndef PREPROCESS_H
 #define PREPROCESS_H
 
+#include <vector>
+
 #include "Macro.h"
 #include "Typedef.h"
 #include "Logging.h"
@@ -21,6 +23,7 @@
 #include "FFT.h"
 #include "Mask.h"
 #include "Filter.h"
+#include "AsyncWriter.h"
 
 /**
  * lower resolution limit for estimating B-factor in Angstrom
@@ -61,6 +64,11 @@ class Postprocess
         
         int _res;
 
+        /**
+         * writer of volumes to files
+         */
+        AsyncWriter _writer;
+
     public:        
 
         Postprocess();
@@ -79,16 +87,33 @@ class Postprocess
          */
         void maskAB(const unsigned int nThread);
 
+        /**
+         * average reference A and reference B in real space
+         */
+        void averageAB(const unsigned int nThread);
+
         void maskABRF(const unsigned int nThread);
 
         void randomPhaseAB(const int randomPhaseThres,
                            const unsigned int nThread);
 
-        void mergeAB();
+        void mergeAB(const unsigned int nThread);
 
         int maxR();
 
         void saveFSC() const;
+
+        /**
+         * write a volume to a file in another thread, the volume should be
+         * kept unchanged until waitWriting() returns
+         */
+        void writeVolumeAsync(const char filename[],
+                              const Volume& vol);
+
+        /**
+         * wait for all volumes being written
+         */
+        void waitWriting();
 };
 
 #endif // PREPROCESS_H
@@ -236,6 +236,20 @@ class Projector
                           const unsigned int nThread    /**< [in] the number of threads to be used */
                           );
 
+        /**
+         * @brief Project from a padded volume in Fourier space which is owned elsewhere, e.g., an MPI shared memory window, instead of a private copy.
+         *
+         * The volume must have been padded and grid corrected as by setProjectee. The memory will not be freed by this projector.
+         */
+        void attachProjectee(Complex* data,  /**< [in] the padded volume in Fourier space */
+                             const int size  /**< [in] the size of the padded volume in real space */
+                            );
+
+        /**
+         * @brief Release the image and the volume to be projected.
+         */
+        void clearProjectee();
+
         /**
          * @brief Project an image using multiple threads, given the rotation matrix.
          */
@@ -376,6 +390,50 @@ class Projector
          * @brief Perform griding correction on projectee.
          */
         void gridCorrection(const unsigned int nThread);
+
+        /**
+         * @brief Project the pixels within the max radius of an image, with the interpolation type and the padding factor fixed at compilation, where pf being 0 stands for the padding factor of this projector.
+         */
+        template <int interp, int pf>
+        void projectKernel(Image& dst,                 /**< [out] the projected image */
+                           const dmat22& mat,          /**< [in]  the 2D rotation matrix */
+                           const unsigned int nThread  /**< [in]  the number of threads to be used */
+                          ) const;
+
+        /**
+         * @brief Project the pixels within the max radius of a volume, with the interpolation type and the padding factor fixed at compilation, where pf being 0 stands for the padding factor of this projector.
+         */
+        template <int interp, int pf>
+        void projectKernel(Image& dst,                 /**< [out] the projected image */
+                           const dmat33& mat,          /**< [in]  the 3D rotation matrix */
+                           const unsigned int nThread  /**< [in]  the number of threads to be used */
+                          ) const;
+
+        /**
+         * @brief Project the pre-determined pixels of an image, with the interpolation type and the padding factor fixed at compilation, where pf being 0 stands for the padding factor of this projector.
+         */
+        template <int interp, int pf>
+        void projectKernel(Complex* dst,               /**< [out] the projected pixels */
+                           const dmat22& mat,          /**< [in]  the 2D rotation matrix */
+                           const int* iCol,            /**< [in]  the index of column */
+                           const int* iRow,            /**< [in]  the index of row */
+                           const int* iPxl,            /**< [in]  the index of each pixel in dst, NULL for storing the pixels continuously */
+                           const int nPxl,             /**< [in]  the number of pixels */
+                           const unsigned int nThread  /**< [in]  the number of threads to be used */
+                          ) const;
+
+        /**
+         * @brief Project the pre-determined pixels of a volume, with the interpolation type and the padding factor fixed at compilation, where pf being 0 stands for the padding factor of this projector.
+         */
+        template <int interp, int pf>
+        void projectKernel(Complex* dst,               /**< [out] the projected pixels */
+                           const dmat33& mat,          /**< [in]  the 3D rotation matrix */
+                           const int* iCol,            /**< [in]  the index of column */
+                           const int* iRow,            /**< [in]  the index of row */
+                           const int* iPxl,            /**< [in]  the index of each pixel in dst, NULL for storing the pixels continuously */
+                           const int nPxl,             /**< [in]  the number of pixels */
+                           const unsigned int nThread  /**< [in]  the number of threads to be used */
+                          ) const;
 };
 
 #endif // PROJECTOR_H
@@ -38,6 +38,7 @@
 #include "FFT.h"
 #include "Image.h"
 #include "Volume.h"
+#include "RealFTVolume.h"
 #include "Particle.h"
 #include "ImageFunctions.h"
 #include "Symmetry.h"
@@ -56,6 +57,19 @@
 
 #define PAD_SIZE (_pf * _size)
 
+/**
+ * kernels of inserting images into the reconstructor, the trilinear one or the
+ * one of Modified Kaiser Bessel Function
+ */
+#define RECONSTRUCTOR_KERNEL_TRILINEAR 0
+#define RECONSTRUCTOR_KERNEL_MKB 1
+
+#ifdef RECONSTRUCTOR_MKB_KERNEL
+#define RECONSTRUCTOR_KERNEL_DEFAULT RECONSTRUCTOR_KERNEL_MKB
+#else
+#define RECONSTRUCTOR_KERNEL_DEFAULT RECONSTRUCTOR_KERNEL_TRILINEAR
+#endif
+
 #define RECO_LOOSE_FACTOR 1
 
 #define MIN_N_ITER_BALANCE 10
@@ -68,6 +82,13 @@
 
 #define N_DIFF_C_NO_DECREASE 2
 
+/**
+ * momentum of balancing weights, W is extrapolated along the update of the
+ * last round in log domain, as long as the distance to total balanced keeps
+ * decreasing
+ */
+#define BALANCE_MOMENTUM 0.5
+
 #define WIENER_FACTOR_MIN_R 5
 
 #define FSC_BASE_L 1e-3
@@ -112,6 +133,16 @@ class Reconstructor : public Parallel
          */
         bool _joinHalf;
 
+        /**
+         * @brief the indicator of whether to insert each image under all symmetry related rotations, instead of symmetrizing _F and _T after insertion
+         */
+        bool _symInsert;
+
+        /**
+         * @brief the kernel of inserting images, RECONSTRUCTOR_KERNEL_TRILINEAR or RECONSTRUCTOR_KERNEL_MKB
+         */
+        int _kernelType;
+
         /**
          * @brief the size (PAD_SIZE) of Volume in 3 dimensions(xyz)
          */
@@ -130,7 +161,7 @@ class Reconstructor : public Parallel
         /**
          * @brief the 2D grid image used to save the balancing weighting factors of every 2D grid point
          */
-        Image _W2D;
+        RealFTVolume _W2D;
 
         /**
          * @brief the 2D grid image helpful to calculate _W in grid correction operation
@@ -140,7 +171,7 @@ class Reconstructor : public Parallel
         /**
          * @brief the 2D grid image used to save the accumulation of weights of every 2D grid point
          */
-        Image _T2D;
+        RealFTVolume _T2D;
 
         /**
          * @brief the 3D grid volume used to save the accumulation of the pixel values of 2D Fourier transforms of inserting images in 3D Fourier space. 
@@ -154,11 +185,12 @@ class Reconstructor : public Parallel
          * Since the discretization in computation, the volume is a 3D grid. Every inserting operation will accumulate weights of associated points got by interpolation of this volume into the grid point of accumulated weights volume _C also by interpolation. After multiple rounds of division by relative accumulated weights of each grid points in volume _C that has been allreduced within all processes, the weights are balanced and normalized, with which can be multiplied with volume _F to get the 3D Fourier transform of the model. 
          * This volume is initialised to be all ones.
          */
-        Volume _W3D;
+        RealFTVolume _W3D;
         
         
         /**
          * @brief the 3D grid volume helpful to calculate _W in grid correction operation
+         * Unlike _W and _T, it has to be complex, as it is transformed into real space and back during convolution.
          */
         Volume _C3D;
 
@@ -167,7 +199,7 @@ class Reconstructor : public Parallel
          * Since the discretization in computation, the volume is a 3D grid. Every inserting operation will accumulate weights of associated points, which is gotten by interpolation of _W grid into the grid point of this volume also by interpolation. An allreduce operation will be done to get the summation of accumulated weights of each grid points of all processes before balancing and normalizing by the division of _W and _C, with which _C can be approximately equal to 1. 
          * This volume is initialised to be all zeros.
          */
-        Volume _T3D;
+        RealFTVolume _T3D;
 
         /**
          * @brief the vector to save the rotation matrices of each insertion with image and associated 5D coordinates. 
@@ -237,6 +269,26 @@ class Reconstructor : public Parallel
          */
         vec _FSC;
 
+        /**
+         * @brief whether the all reducing of _T and _F has been started but not completed
+         */
+        bool _reduceTF;
+
+        /**
+         * @brief handle of the all reducing of _T
+         */
+        MPI_Request_Large _reqT;
+
+        /**
+         * @brief handle of the all reducing of _F
+         */
+        MPI_Request_Large _reqF;
+
+        /**
+         * @brief the factor by which _F is scaled after all reducing, as _T is normalised
+         */
+        RFLOAT _sfF;
+
         /**
          * @brief the average power spectrum of noise, @f$\sigma^{2}@f$
          */
@@ -287,6 +339,23 @@ class Reconstructor : public Parallel
          */
         TabFunction _kernelRL;
 
+        /**
+         * @brief the blob kernel in real space divided by its value at the
+         * origin, tabulated by the squared radius in pixel of the padded
+         * grid
+         */
+        vec _kernelRLQuad;
+
+        /**
+         * @brief the radius of the blob, the smooth factor and the padding
+         * factor that _kernelRLQuad is tabulated for
+         */
+        RFLOAT _kernelRLQuadA;
+
+        RFLOAT _kernelRLQuadAlpha;
+
+        int _kernelRLQuadPf;
+
         /**
          * @brief FFT structure
          */
@@ -307,6 +376,14 @@ class Reconstructor : public Parallel
 
             _joinHalf = false;
 
+            _symInsert = false;
+
+            _kernelType = RECONSTRUCTOR_KERNEL_DEFAULT;
+
+            _kernelRLQuadA = 0;
+            _kernelRLQuadAlpha = 0;
+            _kernelRLQuadPf = 0;
+
             _pf = 2;
             _sym = NULL;
             _a = 1.9;
@@ -319,6 +396,9 @@ class Reconstructor : public Parallel
 
             _FSC = vec::Constant(1, 1);
             _sig = vec::Zero(1);
+
+            _reduceTF = false;
+            _sfF = 1;
             _tau = vec::Constant(1, 1);
 
             _ox = 0;
@@ -432,6 +512,26 @@ class Reconstructor : public Parallel
          */
         void setJoinHalf(const bool joinHalf /**< [in] the indicator of whether to join the two halves(TRUE) or not(FALSE) */);
 
+        /**
+         * @brief Return the indicator of whether to insert each image under all symmetry related rotations(TRUE) or to symmetrize after insertion(FALSE).
+         */
+        bool symInsert() const;
+
+        /**
+         * @brief Set the indicator of whether to insert each image under all symmetry related rotations(TRUE) or to symmetrize after insertion(FALSE). It only takes effect in 3D mode on insertP.
+         */
+        void setSymInsert(const bool symInsert /**< [in] the indicator of whether to insert under all symmetry related rotations(TRUE) or not(FALSE) */);
+
+        /**
+         * @brief Return the kernel of inserting images.
+         */
+        int kernelType() const;
+
+        /**
+         * @brief Set the kernel of inserting images, RECONSTRUCTOR_KERNEL_TRILINEAR or RECONSTRUCTOR_KERNEL_MKB. It also decides the convolution kernel corrected in reconstruction. It does not take effect on insertI.
+         */
+        void setKernelType(const int kernelType /**< [in] the kernel of inserting images */);
+
         /** 
          * @brief Set the symmetry mark of the model to be reconstructed.
          */
@@ -697,6 +797,11 @@ class Reconstructor : public Parallel
         void prepareTFG(int gpuIdx   /**< [in] gpu index */);
 #endif
 
+        /**
+         * @brief Start all reducing _T and _F without blocking. Starting it for all references before preparing each of them lets the all reducing of a reference overlap the normalisation and symmetrization of the former ones. All processes must start the all reducing of references in the same order.
+         */
+        void startAllReduceTF();
+
         /**
          * @brief Prepare parameters for symmetrizing _T and _F by CPU.
          */
@@ -733,14 +838,14 @@ class Reconstructor : public Parallel
 
         Volume& getF3D();
 
-        Volume& getT3D(); 
+        RealFTVolume& getT3D(); 
 
     private:
 
         /**
          * @brief The allreduce operation gets the final summation of _F volumes of all processes, by which the 3D Fourier transform of the model is obtained. The size of the reconstructor area that is used to determine the size of Volume in 3 dimension xyz.
          */
-        void allReduceF();
+        void allReduceF(const unsigned int nThread   /**< [in] the number of threads */);
 
         /**
          * @brief The allreduce operation gets the summation of _T volumes. Get the summation of accumulated weights value of each grid points of all processes before balancing and normalization by the divion of _W and _C, with which _C can be approximately equal to 1.
@@ -778,6 +883,85 @@ class Reconstructor : public Parallel
          * @brief Symmetrize X-offset, Y-offset and Z-offset of reference.
          */
         void symmetrizeO();      
+
+        /**
+         * @brief Add a value and its weight on an irregular pixel of _F2D and _T2D by the kernel fixed at compilation.
+         */
+        template <int kernel>
+        inline void addFT2D(const Complex f,   /**< [in] the value to be added on _F2D */
+                            const RFLOAT t,    /**< [in] the weight to be added on _T2D */
+                            const RFLOAT iCol, /**< [in] column index of the irregular pixel */
+                            const RFLOAT iRow  /**< [in] row index of the irregular pixel */
+                           );
+
+        /**
+         * @brief Add a value and its weight on an irregular voxel of _F3D and _T3D by the kernel fixed at compilation.
+         */
+        template <int kernel>
+        inline void addFT3D(const Complex f,   /**< [in] the value to be added on _F3D */
+                            const RFLOAT t,    /**< [in] the weight to be added on _T3D */
+                            const RFLOAT iCol, /**< [in] column index of the irregular voxel */
+                            const RFLOAT iRow, /**< [in] row index of the irregular voxel */
+                            const RFLOAT iSlc  /**< [in] slice index of the irregular voxel */
+                           );
+
+        /**
+         * @brief insert, by the kernel fixed at compilation
+         */
+        template <int kernel>
+        void insertKernel(const Image& src,
+                          const Image& ctf,
+                          const dmat22& rot,
+                          const RFLOAT w);
+
+        /**
+         * @brief insert, by the kernel fixed at compilation
+         */
+        template <int kernel>
+        void insertKernel(const Image& src,
+                          const Image& ctf,
+                          const dmat33& rot,
+                          const RFLOAT w);
+
+        /**
+         * @brief insertP, by the kernel fixed at compilation
+         */
+        template <int kernel>
+        void insertPKernel(const Image& src,
+                           const Image& ctf,
+                           const dmat22& rot,
+                           const RFLOAT w,
+                           const vec* sig);
+
+        /**
+         * @brief insertP, by the kernel fixed at compilation
+         */
+        template <int kernel>
+        void insertPKernel(const Image& src,
+                           const Image& ctf,
+                           const dmat33& rot,
+                           const RFLOAT w,
+                           const vec* sig);
+
+        /**
+         * @brief insertP, by the kernel fixed at compilation
+         */
+        template <int kernel>
+        void insertPKernel(const Complex* src,
+                           const RFLOAT* ctf,
+                           const dmat22& rot,
+                           const RFLOAT w,
+                           const vec* sig);
+
+        /**
+         * @brief insertP, by the kernel fixed at compilation
+         */
+        template <int kernel>
+        void insertPKernel(const Complex* src,
+                           const RFLOAT* ctf,
+                           const dmat33& rot,
+                           const RFLOAT w,
+                           const vec* sig);
 };
 
 #endif //RECONSTRUCTOR_H:
@@ -149,3 +149,212 @@ void CTF(RFLOAT* dst,
         dst[i] = -w1 * TS_SIN(ki) + w2 * TS_COS(ki);
     }
 }
+
+#define SIN_DP1 0.78515625f
+#define SIN_DP2 2.4187564849853515625e-4f
+#define SIN_DP3 3.77489497744594108e-8f
+
+#define SIN_S0 -1.9515295891e-4f
+#define SIN_S1 8.3321608736e-3f
+#define SIN_S2 -1.6666654611e-1f
+
+#define COS_C0 2.443315711809948e-5f
+#define COS_C1 -1.388731625493765e-3f
+#define COS_C2 4.166664568298827e-2f
+
+// beyond it the range reduction loses accuracy, leave it to sin()
+#define SIN_MAX_ARG 8192.0f
+
+#if defined(SINGLE_PRECISION) && (defined(ENABLE_SIMD_256) || defined(ENABLE_SIMD_512))
+
+static inline __m256 sin256(__m256 x)
+{
+    __m256 signMask = _mm256_set1_ps(-0.0f);
+
+    __m256 sign = _mm256_and_ps(x, signMask);
+
+    x = _mm256_andnot_ps(signMask, x);
+
+    // octant of |x|, rounded up to an even one
+    __m256 y = _mm256_floor_ps(_mm256_mul_ps(x, _mm256_set1_ps(4 / M_PI)));
+
+    y = _mm256_add_ps(y, _mm256_sub_ps(y, _mm256_mul_ps(_mm256_set1_ps(2),
+                                                        _mm256_floor_ps(_mm256_mul_ps(y, _mm256_set1_ps(0.5f))))));
+
+    __m256 q = _mm256_sub_ps(y, _mm256_mul_ps(_mm256_set1_ps(8),
+                                              _mm256_floor_ps(_mm256_mul_ps(y, _mm256_set1_ps(0.125f)))));
+
+    sign = _mm256_xor_ps(sign, _mm256_and_ps(_mm256_cmp_ps(q, _mm256_set1_ps(4), _CMP_GE_OQ), signMask));
+
+    __m256 cosBranch = _mm256_or_ps(_mm256_cmp_ps(q, _mm256_set1_ps(2), _CMP_EQ_OQ),
+                                    _mm256_cmp_ps(q, _mm256_set1_ps(6), _CMP_EQ_OQ));
+
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(SIN_DP1)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(SIN_DP2)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(SIN_DP3)));
+
+    __m256 z = _mm256_mul_ps(x, x);
+
+    __m256 c = _mm256_set1_ps(COS_C0);
+    c = _mm256_add_ps(_mm256_mul_ps(c, z), _mm256_set1_ps(COS_C1));
+    c = _mm256_add_ps(_mm256_mul_ps(c, z), _mm256_set1_ps(COS_C2));
+    c = _mm256_mul_ps(_mm256_mul_ps(c, z), z);
+    c = _mm256_sub_ps(c, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    c = _mm256_add_ps(c, _mm256_set1_ps(1));
+
+    __m256 s = _mm256_set1_ps(SIN_S0);
+    s = _mm256_add_ps(_mm256_mul_ps(s, z), _mm256_set1_ps(SIN_S1));
+    s = _mm256_add_ps(_mm256_mul_ps(s, z), _mm256_set1_ps(SIN_S2));
+    s = _mm256_mul_ps(_mm256_mul_ps(s, z), x);
+    s = _mm256_add_ps(s, x);
+
+    return _mm256_xor_ps(_mm256_blendv_ps(s, c, cosBranch), sign);
+}
+
+#endif
+
+static void vsin(RFLOAT* dst,
+                 const RFLOAT* src,
+                 const int n)
+{
+    int i = 0;
+
+#if defined(SINGLE_PRECISION) && (defined(ENABLE_SIMD_256) || defined(ENABLE_SIMD_512))
+    __m256 signMask = _mm256_set1_ps(-0.0f);
+
+    for (; i <= n - 8; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(src + i);
+
+        if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(signMask, x),
+                                             _mm256_set1_ps(SIN_MAX_ARG),
+                                             _CMP_GT_OQ)))
+        {
+            for (int j = i; j < i + 8; j++)
+                dst[j] = sin(src[j]);
+        }
+        else
+            _mm256_storeu_ps(dst + i, sin256(x));
+    }
+#endif
+
+    for (; i < n; i++)
+        dst[i] = sin(src[i]);
+}
+
+void CTFGeometry::init(const RFLOAT pixelSize,
+                       const int nCol,
+                       const int nRow,
+                       const int* iCol,
+                       const int* iRow,
+                       const int nPxl)
+{
+    _f2.resize(nPxl);
+    _c2.resize(nPxl);
+    _s2.resize(nPxl);
+
+    for (int i = 0; i < nPxl; i++)
+    {
+        _f2[i] = TSGSL_pow_2(iCol[i] / (pixelSize * nCol))
+               + TSGSL_pow_2(iRow[i] / (pixelSize * nRow));
+
+        // cos(2 * atan2(y, x)) and sin(2 * atan2(y, x)), atan2(0, 0) = 0
+        double q = QUAD(iCol[i], iRow[i]);
+
+        _c2[i] = (q == 0) ? 1 : (TSGSL_pow_2(iCol[i]) - TSGSL_pow_2(iRow[i])) / q;
+        _s2[i] = (q == 0) ? 0 : 2.0 * iCol[i] * iRow[i] / q;
+    }
+}
+
+void CTFGeometry::clear()
+{
+    _f2.clear();
+    _c2.clear();
+    _s2.clear();
+}
+
+void CTF(RFLOAT* dst,
+         const CTFGeometry& geom,
+         const RFLOAT voltage,
+         const RFLOAT defocusU,
+         const RFLOAT defocusV,
+         const RFLOAT theta,
+         const RFLOAT Cs,
+         const RFLOAT amplitudeContrast,
+         const RFLOAT phaseShift)
+{
+    RFLOAT lambda = 12.2643247 / sqrt(voltage * (1 + voltage * 0.978466e-6));
+
+    RFLOAT K1 = M_PI * lambda;
+    RFLOAT K2 = M_PI_2 * Cs * TSGSL_pow_3(lambda);
+
+    // defocus = dA + dC * cos(2 * alpha_g) + dS * sin(2 * alpha_g)
+    RFLOAT dA = -(defocusU + defocusV) / 2;
+    RFLOAT dC = -(defocusU - defocusV) / 2 * cos(2 * theta);
+    RFLOAT dS = -(defocusU - defocusV) / 2 * sin(2 * theta);
+
+    RFLOAT phase = phaseShift + asin(amplitudeContrast);
+
+    const RFLOAT* f2 = geom.f2();
+    const RFLOAT* c2 = geom.c2();
+    const RFLOAT* s2 = geom.s2();
+
+    int n = geom.nPxl();
+
+    // -sin(ki - asin(A)) = sin(phaseShift + asin(A) - ki)
+    for (int i = 0; i < n; i++)
+        dst[i] = phase
+               - (K1 * (dA + dC * c2[i] + dS * s2[i]) + K2 * f2[i]) * f2[i];
+
+    vsin(dst, dst, n);
+}
+
+void CTF(RFLOAT* dst,
+         const CTFGeometry& geom,
+         const RFLOAT* d,
+         const int nD,
+         const RFLOAT voltage,
+         const RFLOAT defocusU,
+         const RFLOAT defocusV,
+         const RFLOAT theta,
+         const RFLOAT Cs,
+         const RFLOAT amplitudeContrast,
+         const RFLOAT phaseShift)
+{
+    RFLOAT lambda = 12.2643247 / sqrt(voltage * (1 + voltage * 0.978466e-6));
+
+    RFLOAT K1 = M_PI * lambda;
+    RFLOAT K2 = M_PI_2 * Cs * TSGSL_pow_3(lambda);
+
+    RFLOAT dA = -(defocusU + defocusV) / 2;
+    RFLOAT dC = -(defocusU - defocusV) / 2 * cos(2 * theta);
+    RFLOAT dS = -(defocusU - defocusV) / 2 * sin(2 * theta);
+
+    RFLOAT phase = phaseShift + asin(amplitudeContrast);
+
+    const RFLOAT* f2 = geom.f2();
+    const RFLOAT* c2 = geom.c2();
+    const RFLOAT* s2 = geom.s2();
+
+    int n = geom.nPxl();
+
+    // the argument of the sine is b - a * d for each pixel
+    vector<RFLOAT> a(n);
+    vector<RFLOAT> b(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        a[i] = K1 * (dA + dC * c2[i] + dS * s2[i]) * f2[i];
+        b[i] = phase - K2 * f2[i] * f2[i];
+    }
+
+    for (int k = 0; k < nD; k++)
+    {
+        RFLOAT* row = dst + (size_t)k * n;
+
+        for (int i = 0; i < n; i++)
+            row[i] = b[i] - a[i] * d[k];
+    }
+
+    vsin(dst, dst, n * nD);
+}
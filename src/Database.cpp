@@ -242,6 +242,9 @@ void Database::shuffle()
             _reg[i] = i;
 
 #ifdef DATABASE_SHUFFLE
+        // a stream of its own, apart from the ones of particles
+        seed_random_engine(0, -1, 0);
+
         gsl_rng* engine = get_random_engine();
 
         TSGSL_ran_shuffle(engine, &_reg[0], _reg.size(), sizeof(int));
@@ -129,15 +129,18 @@ void FFT::fw(Image& img,
     ***/
     FW_EXTRACT_P(img);
 
-    TSFFTW_plan_with_nthreads(nThread);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
 
-    fwPlan = TSFFTW_plan_dft_r2c_2d(img.nRowRL(),
-                                  img.nColRL(),
-                                  _srcR,
-                                  _dstC,
-                                  FFTW_ESTIMATE);
+        fwPlan = TSFFTW_plan_dft_r2c_2d(img.nRowRL(),
+                                      img.nColRL(),
+                                      _srcR,
+                                      _dstC,
+                                      FFTW_ESTIMATE);
 
-    TSFFTW_plan_with_nthreads(1);
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_execute(fwPlan);
 
@@ -155,15 +158,18 @@ void FFT::bw(Image& img,
     ***/
     BW_EXTRACT_P(img);
 
-    TSFFTW_plan_with_nthreads(nThread);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
 
-    bwPlan = TSFFTW_plan_dft_c2r_2d(img.nRowRL(),
-                                  img.nColRL(),
-                                  _srcC,
-                                  _dstR,
-                                  FFTW_ESTIMATE);
+        bwPlan = TSFFTW_plan_dft_c2r_2d(img.nRowRL(),
+                                      img.nColRL(),
+                                      _srcC,
+                                      _dstR,
+                                      FFTW_ESTIMATE);
 
-    TSFFTW_plan_with_nthreads(1);
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_execute(bwPlan);
 
@@ -178,23 +184,26 @@ void FFT::fw(Volume& vol,
 {
     FW_EXTRACT_P(vol);
 
-    TSFFTW_plan_with_nthreads(nThread);
-
-    if (vol.nSlcRL() == 1)
-        fwPlan = TSFFTW_plan_dft_r2c_2d(vol.nRowRL(),
-                                        vol.nColRL(),
-                                        _srcR,
-                                        _dstC,
-                                        FFTW_ESTIMATE);
-    else
-        fwPlan = TSFFTW_plan_dft_r2c_3d(vol.nRowRL(),
-                                        vol.nColRL(),
-                                        vol.nSlcRL(),
-                                        _srcR,
-                                        _dstC,
-                                        FFTW_ESTIMATE);
-
-    TSFFTW_plan_with_nthreads(1);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
+
+        if (vol.nSlcRL() == 1)
+            fwPlan = TSFFTW_plan_dft_r2c_2d(vol.nRowRL(),
+                                            vol.nColRL(),
+                                            _srcR,
+                                            _dstC,
+                                            FFTW_ESTIMATE);
+        else
+            fwPlan = TSFFTW_plan_dft_r2c_3d(vol.nRowRL(),
+                                            vol.nColRL(),
+                                            vol.nSlcRL(),
+                                            _srcR,
+                                            _dstC,
+                                            FFTW_ESTIMATE);
+
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_execute(fwPlan);
 
@@ -206,22 +215,25 @@ void FFT::bw(Volume& vol,
 {
     BW_EXTRACT_P(vol);
 
-    TSFFTW_plan_with_nthreads(nThread);
-
-    if (vol.nSlcRL() == 1)
-        bwPlan = TSFFTW_plan_dft_c2r_2d(vol.nRowRL(),
-                                      vol.nColRL(),
-                                      _srcC,
-                                      _dstR,
-                                      FFTW_ESTIMATE);
-    else
-        bwPlan = TSFFTW_plan_dft_c2r_3d(vol.nRowRL(),
-                                      vol.nColRL(),
-                                      vol.nSlcRL(),
-                                      _srcC,
-                                      _dstR,
-                                      FFTW_ESTIMATE);
-    TSFFTW_plan_with_nthreads(1);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
+
+        if (vol.nSlcRL() == 1)
+            bwPlan = TSFFTW_plan_dft_c2r_2d(vol.nRowRL(),
+                                          vol.nColRL(),
+                                          _srcC,
+                                          _dstR,
+                                          FFTW_ESTIMATE);
+        else
+            bwPlan = TSFFTW_plan_dft_c2r_3d(vol.nRowRL(),
+                                          vol.nColRL(),
+                                          vol.nSlcRL(),
+                                          _srcC,
+                                          _dstR,
+                                          FFTW_ESTIMATE);
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_execute(bwPlan);
 
@@ -238,15 +250,18 @@ void FFT::fwCreatePlan(const long nCol,
     _srcR = (RFLOAT*)TSFFTW_malloc(nCol * nRow * sizeof(RFLOAT));
     _dstC = (TSFFTW_COMPLEX*)TSFFTW_malloc((nCol / 2 + 1) * nRow * sizeof(Complex));
 
-    TSFFTW_plan_with_nthreads(nThread);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
 
-    fwPlan = TSFFTW_plan_dft_r2c_2d(nRow,
-                                  nCol,
-                                  _srcR,
-                                  _dstC,
-                                  FFTW_MEASURE);
+        fwPlan = TSFFTW_plan_dft_r2c_2d(nRow,
+                                      nCol,
+                                      _srcR,
+                                      _dstC,
+                                      FFTW_MEASURE);
 
-    TSFFTW_plan_with_nthreads(1);
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_free(_srcR);
     TSFFTW_free(_dstC);
@@ -260,16 +275,19 @@ void FFT::fwCreatePlan(const long nCol,
     _srcR = (RFLOAT*)TSFFTW_malloc(nCol * nRow * nSlc * sizeof(RFLOAT));
     _dstC = (TSFFTW_COMPLEX*)TSFFTW_malloc((nCol / 2 + 1) * nRow * nSlc * sizeof(Complex));
 
-    TSFFTW_plan_with_nthreads(nThread);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
 
-    fwPlan = TSFFTW_plan_dft_r2c_3d(nRow,
-                                  nCol,
-                                  nSlc,
-                                  _srcR,
-                                  _dstC,
-                                  FFTW_MEASURE);
+        fwPlan = TSFFTW_plan_dft_r2c_3d(nRow,
+                                      nCol,
+                                      nSlc,
+                                      _srcR,
+                                      _dstC,
+                                      FFTW_MEASURE);
 
-    TSFFTW_plan_with_nthreads(1);
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_free(_srcR);
     TSFFTW_free(_dstC);
@@ -282,15 +300,18 @@ void FFT::bwCreatePlan(const long nCol,
     _srcC = (TSFFTW_COMPLEX*)TSFFTW_malloc((nCol / 2 + 1) * nRow * sizeof(Complex));
     _dstR = (RFLOAT*)TSFFTW_malloc(nCol * nRow * sizeof(RFLOAT));
  
-    TSFFTW_plan_with_nthreads(nThread);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
 
-    bwPlan = TSFFTW_plan_dft_c2r_2d(nRow,
-                                  nCol,
-                                  _srcC,
-                                  _dstR,
-                                  FFTW_MEASURE);
+        bwPlan = TSFFTW_plan_dft_c2r_2d(nRow,
+                                      nCol,
+                                      _srcC,
+                                      _dstR,
+                                      FFTW_MEASURE);
 
-    TSFFTW_plan_with_nthreads(1);
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_free(_srcC);
     TSFFTW_free(_dstR);
@@ -304,16 +325,19 @@ void FFT::bwCreatePlan(const long nCol,
     _srcC = (TSFFTW_COMPLEX*)TSFFTW_malloc((nCol / 2 + 1) * nRow * nSlc * sizeof(Complex));
     _dstR = (RFLOAT*)TSFFTW_malloc(nCol * nRow * nSlc * sizeof(RFLOAT));
 
-    TSFFTW_plan_with_nthreads(nThread);
+    #pragma omp critical (FFT_PLAN)
+    {
+        TSFFTW_plan_with_nthreads(nThread);
 
-    bwPlan = TSFFTW_plan_dft_c2r_3d(nRow,
-                                  nCol,
-                                  nSlc,
-                                  _srcC,
-                                  _dstR,
-                                  FFTW_MEASURE);
+        bwPlan = TSFFTW_plan_dft_c2r_3d(nRow,
+                                      nCol,
+                                      nSlc,
+                                      _srcC,
+                                      _dstR,
+                                      FFTW_MEASURE);
 
-    TSFFTW_plan_with_nthreads(1);
+        TSFFTW_plan_with_nthreads(1);
+    }
 
     TSFFTW_free(_srcC);
     TSFFTW_free(_dstR);
@@ -375,10 +399,19 @@ void FFT::bwExecutePlan(Volume& vol,
     vol.clearFT();
 }
 
+void FFT::bwExecutePlan(Image& dst,
+                        Image& src) const
+{
+    TSFFTW_execute_dft_c2r(bwPlan, (TSFFTW_COMPLEX*)&src[0], &dst(0));
+
+    SCALE_RL(dst, 1.0 / dst.sizeRL());
+}
+
 void FFT::fwDestroyPlan()
 {
     if (fwPlan)
     {
+        #pragma omp critical (FFT_PLAN)
         TSFFTW_destroy_plan(fwPlan);
 
         fwPlan = NULL;
@@ -389,6 +422,7 @@ void FFT::bwDestroyPlan()
 {
     if (bwPlan)
     {
+        #pragma omp critical (FFT_PLAN)
         TSFFTW_destroy_plan(bwPlan);
 
         bwPlan = NULL;
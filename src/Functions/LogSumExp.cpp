@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description:
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#include "LogSumExp.h"
+
+#define EXP_HI 88.0f
+#define EXP_LO -87.3365478515625f
+
+#define EXP_LOG2E 1.44269504088896341f
+#define EXP_C1 0.693359375f
+#define EXP_C2 -2.12194440e-4f
+
+#define EXP_P0 1.9875691500e-4f
+#define EXP_P1 1.3981999507e-3f
+#define EXP_P2 8.3334519073e-3f
+#define EXP_P3 4.1665795894e-2f
+#define EXP_P4 1.6666665459e-1f
+#define EXP_P5 5.0000001201e-1f
+
+#if defined(SINGLE_PRECISION) && defined(ENABLE_SIMD_512)
+
+static inline __m512 exp512(__m512 x)
+{
+    __mmask16 under = _mm512_cmp_ps_mask(x, _mm512_set1_ps(EXP_LO), _CMP_LT_OQ);
+
+    x = _mm512_min_ps(x, _mm512_set1_ps(EXP_HI));
+    x = _mm512_max_ps(x, _mm512_set1_ps(EXP_LO));
+
+    // x = n * ln2 + r, |r| <= ln2 / 2
+    __m512 n = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(EXP_LOG2E)),
+                                    _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    x = _mm512_sub_ps(x, _mm512_mul_ps(n, _mm512_set1_ps(EXP_C1)));
+    x = _mm512_sub_ps(x, _mm512_mul_ps(n, _mm512_set1_ps(EXP_C2)));
+
+    __m512 z = _mm512_mul_ps(x, x);
+
+    __m512 y = _mm512_set1_ps(EXP_P0);
+    y = _mm512_add_ps(_mm512_mul_ps(y, x), _mm512_set1_ps(EXP_P1));
+    y = _mm512_add_ps(_mm512_mul_ps(y, x), _mm512_set1_ps(EXP_P2));
+    y = _mm512_add_ps(_mm512_mul_ps(y, x), _mm512_set1_ps(EXP_P3));
+    y = _mm512_add_ps(_mm512_mul_ps(y, x), _mm512_set1_ps(EXP_P4));
+    y = _mm512_add_ps(_mm512_mul_ps(y, x), _mm512_set1_ps(EXP_P5));
+    y = _mm512_add_ps(_mm512_mul_ps(y, z), x);
+    y = _mm512_add_ps(y, _mm512_set1_ps(1));
+
+    y = _mm512_scalef_ps(y, n);
+
+    return _mm512_mask_mov_ps(y, under, _mm512_setzero_ps());
+}
+
+#elif defined(SINGLE_PRECISION) && defined(ENABLE_SIMD_256)
+
+static inline __m256 exp256(__m256 x)
+{
+    __m256 under = _mm256_cmp_ps(x, _mm256_set1_ps(EXP_LO), _CMP_LT_OQ);
+
+    x = _mm256_min_ps(x, _mm256_set1_ps(EXP_HI));
+    x = _mm256_max_ps(x, _mm256_set1_ps(EXP_LO));
+
+    // x = n * ln2 + r, |r| <= ln2 / 2
+    __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(EXP_LOG2E)),
+                               _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    x = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(EXP_C1)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(EXP_C2)));
+
+    __m256 z = _mm256_mul_ps(x, x);
+
+    __m256 y = _mm256_set1_ps(EXP_P0);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(EXP_P1));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(EXP_P2));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(EXP_P3));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(EXP_P4));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(EXP_P5));
+    y = _mm256_add_ps(_mm256_mul_ps(y, z), x);
+    y = _mm256_add_ps(y, _mm256_set1_ps(1));
+
+    // build 2^n in the exponent field, AVX has no 256-bit integer arithmetic
+    __m256i ni = _mm256_cvtps_epi32(n);
+
+    __m128i lo = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(ni),
+                                              _mm_set1_epi32(0x7f)),
+                                23);
+    __m128i hi = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(ni, 1),
+                                              _mm_set1_epi32(0x7f)),
+                                23);
+
+    __m256 p = _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+
+    y = _mm256_mul_ps(y, p);
+
+    return _mm256_andnot_ps(under, y);
+}
+
+#endif
+
+void vexp(RFLOAT* dst,
+          const RFLOAT* src,
+          const int n)
+{
+    int i = 0;
+
+#if defined(SINGLE_PRECISION) && defined(ENABLE_SIMD_512)
+    for (; i <= n - 16; i += 16)
+        _mm512_storeu_ps(dst + i, exp512(_mm512_loadu_ps(src + i)));
+#elif defined(SINGLE_PRECISION) && defined(ENABLE_SIMD_256)
+    for (; i <= n - 8; i += 8)
+        _mm256_storeu_ps(dst + i, exp256(_mm256_loadu_ps(src + i)));
+#endif
+
+    for (; i < n; i++)
+        dst[i] = exp(src[i]);
+}
+
+RFLOAT vmax(const RFLOAT* src,
+            const int n)
+{
+    RFLOAT m = src[0];
+
+    int i = 0;
+
+#if defined(SINGLE_PRECISION) && defined(ENABLE_SIMD_512)
+    if (n >= 16)
+    {
+        __m512 v = _mm512_loadu_ps(src);
+
+        for (i = 16; i <= n - 16; i += 16)
+            v = _mm512_max_ps(v, _mm512_loadu_ps(src + i));
+
+        m = _mm512_reduce_max_ps(v);
+    }
+#elif defined(SINGLE_PRECISION) && defined(ENABLE_SIMD_256)
+    if (n >= 8)
+    {
+        __m256 v = _mm256_loadu_ps(src);
+
+        for (i = 8; i <= n - 8; i += 8)
+            v = _mm256_max_ps(v, _mm256_loadu_ps(src + i));
+
+        RFLOAT tmp[8];
+
+        _mm256_storeu_ps(tmp, v);
+
+        m = tmp[0];
+
+        for (int j = 1; j < 8; j++)
+            m = (tmp[j] > m) ? tmp[j] : m;
+    }
+#endif
+
+    for (; i < n; i++)
+        m = (src[i] > m) ? src[i] : m;
+
+    return m;
+}
+
+RFLOAT blockWeight(RFLOAT* w,
+                   const RFLOAT* logW,
+                   const int n)
+{
+    RFLOAT m = vmax(logW, n);
+
+    for (int i = 0; i < n; i++)
+        w[i] = logW[i] - m;
+
+    vexp(w, w, n);
+
+    return m;
+}
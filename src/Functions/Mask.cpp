@@ -609,83 +609,353 @@ void removeIsolatedPoint(Volume& vol,
     vol.swap(volTmp);
 }
 
-void extMask(Volume& vol,
-             const RFLOAT ext,
-             const unsigned int nThread)
+/**
+ * the lower envelope of the parabolas (q - p)^2 + f(p) at each site q of a
+ * line, sites of infinite f excluded
+ */
+static void distanceTransform1D(double* d,
+                                const double* f,
+                                const int n,
+                                int* v,
+                                double* z)
 {
-    Volume volTmp = vol.copyVolume();
+    int k = -1;
+
+    for (int q = 0; q < n; q++)
+    {
+        if (f[q] == HUGE_VAL) continue;
+
+        if (k < 0)
+        {
+            k = 0;
+            v[0] = q;
+            z[0] = -HUGE_VAL;
+            z[1] = HUGE_VAL;
+
+            continue;
+        }
 
-    int a = CEIL(std::abs(ext));
+        // z[0] is -HUGE_VAL, thus the first parabola is never popped
+        double s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * (q - v[k]));
 
-    if (ext > 0)
+        while (s <= z[k])
+        {
+            k--;
+
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * (q - v[k]));
+        }
+
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = HUGE_VAL;
+    }
+
+    if (k < 0)
     {
-        #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-        VOLUME_FOR_EACH_PIXEL_RL(vol)
-            if (vol.getRL(i, j, k) == 1)
-                VOLUME_FOR_EACH_PIXEL_IN_GRID(a)
-                    if (QUAD_3(x, y, z) < TSGSL_pow_2(ext))
-                        volTmp.setRL(1, i + x, j + y, k + z);
+        for (int q = 0; q < n; q++) d[q] = HUGE_VAL;
+
+        return;
     }
-    else if (ext < 0)
+
+    k = 0;
+
+    for (int q = 0; q < n; q++)
     {
-        #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-        VOLUME_FOR_EACH_PIXEL_RL(vol)
-            if (vol.getRL(i, j, k) == 0)
-                VOLUME_FOR_EACH_PIXEL_IN_GRID(a)
-                    if (QUAD_3(x, y, z) < TSGSL_pow_2(ext))
-                        volTmp.setRL(0, i + x, j + y, k + z);
+        while (z[k + 1] < q) k++;
+
+        d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
     }
+}
 
-    vol.swap(volTmp);
+/**
+ * transform along one axis of dst, in place; a line is walked in spatial order
+ * from -n / 2 to n / 2 - 1, its voxels being stride apart in memory
+ */
+static void distanceTransformAxis(RFLOAT* dst,
+                                  const long n,
+                                  const long stride,
+                                  const long nLine,
+                                  const long lineStride,
+                                  const long nLineOut,
+                                  const long lineStrideOut,
+                                  const unsigned int nThread)
+{
+    #pragma omp parallel num_threads(nThread)
+    {
+        vector<double> f(n);
+        vector<double> d(n);
+        vector<int> v(n);
+        vector<double> z(n + 1);
+
+        #pragma omp for schedule(dynamic)
+        for (long line = 0; line < nLine * nLineOut; line++)
+        {
+            size_t base = (line % nLine) * lineStride
+                        + (line / nLine) * lineStrideOut;
+
+            for (long p = 0; p < n; p++)
+            {
+                long c = p - n / 2;
+                RFLOAT x = dst[base + (c >= 0 ? c : c + n) * stride];
+
+                f[p] = (x == FLT_MAX) ? HUGE_VAL : x;
+            }
+
+            distanceTransform1D(&d[0], &f[0], n, &v[0], &z[0]);
+
+            for (long p = 0; p < n; p++)
+            {
+                long c = p - n / 2;
+                dst[base + (c >= 0 ? c : c + n) * stride] = (d[p] == HUGE_VAL) ? FLT_MAX : d[p];
+            }
+        }
+    }
 }
 
-void softEdge(Volume& vol,
-              const RFLOAT ew,
-              const unsigned int nThread)
+void distanceTransform(Volume& dst,
+                       const Volume& src,
+                       const RFLOAT value,
+                       const unsigned int nThread)
 {
-    int a = CEIL(ew);
+    long nCol = src.nColRL();
+    long nRow = src.nRowRL();
+    long nSlc = src.nSlcRL();
 
-    Volume distance(vol.nColRL(),
-                    vol.nRowRL(),
-                    vol.nSlcRL(),
-                    RL_SPACE);
+    dst.alloc(nCol, nRow, nSlc, RL_SPACE);
 
+    // squares of distances are integers, exact in RFLOAT
     #pragma omp parallel for num_threads(nThread)
-    FOR_EACH_PIXEL_RL(distance)
-        distance(i) = FLT_MAX;
+    for (size_t i = 0; i < src.sizeRL(); i++)
+        dst(i) = (src.iGetRL(i) == value) ? 0 : FLT_MAX;
+
+    // columns, rows, slices
+    distanceTransformAxis(&dst(0), nCol, 1, nRow, nCol, nSlc, nCol * nRow, nThread);
+    distanceTransformAxis(&dst(0), nRow, nCol, nCol, 1, nSlc, nCol * nRow, nThread);
+    distanceTransformAxis(&dst(0), nSlc, nCol * nRow, nCol, 1, nRow, nCol, nThread);
+}
+
+static inline int findRoot(int* parent,
+                           int i)
+{
+    // path halving, a parent is always of a smaller index than its child
+    while (parent[i] != i)
+    {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+
+    return i;
+}
+
+static inline void unite(int* parent,
+                         const int a,
+                         const int b)
+{
+    if ((parent[a] < 0) || (parent[b] < 0)) return;
+
+    int ra = findRoot(parent, a);
+    int rb = findRoot(parent, b);
+
+    if (ra < rb)
+        parent[rb] = ra;
+    else if (rb < ra)
+        parent[ra] = rb;
+}
+
+/**
+ * the index of the voxel next to index x in space, -1 for the last one; as
+ * indices are wrapped, n / 2 - 1 is the last and n - 1 is followed by 0
+ */
+static inline int nextVoxel(const int x,
+                            const int n)
+{
+    if (x == n / 2 - 1) return -1;
+
+    return (x + 1 == n) ? 0 : x + 1;
+}
+
+static void uniteSlice(int* parent,
+                       const int k,
+                       const int nCol,
+                       const int nRow)
+{
+    for (int j = 0; j < nRow; j++)
+    {
+        int jn = nextVoxel(j, nRow);
+
+        for (int i = 0; i < nCol; i++)
+        {
+            int index = (k * nRow + j) * nCol + i;
+
+            int in = nextVoxel(i, nCol);
+
+            if (in != -1) unite(parent, index, (k * nRow + j) * nCol + in);
+            if (jn != -1) unite(parent, index, (k * nRow + jn) * nCol + i);
+        }
+    }
+}
+
+static void uniteSlices(int* parent,
+                        const int k,
+                        const int kn,
+                        const int nCol,
+                        const int nRow)
+{
+    int nPxl = nCol * nRow;
+
+    for (int i = 0; i < nPxl; i++)
+        unite(parent, k * nPxl + i, kn * nPxl + i);
+}
 
-    omp_lock_t* mtx = new omp_lock_t[vol.sizeRL()];
+int labelComponent(vector<int>& label,
+                   vector<size_t>& size,
+                   const Volume& vol,
+                   const unsigned int nThread)
+{
+    int nCol = vol.nColRL();
+    int nRow = vol.nRowRL();
+    int nSlc = vol.nSlcRL();
+
+    int n = vol.sizeRL();
+
+    label.resize(n);
+
+    int* parent = &label[0];
 
     #pragma omp parallel for num_threads(nThread)
-    for (int i = 0; i < (int)vol.sizeRL(); i++)
-        omp_init_lock(&mtx[i]);
+    for (int i = 0; i < n; i++)
+        parent[i] = (vol.iGetRL(i) == 1) ? i : -1;
 
-    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-    VOLUME_FOR_EACH_PIXEL_RL(vol)
-        if (vol.getRL(i, j, k) == 1)
-            VOLUME_FOR_EACH_PIXEL_IN_GRID(a)
-            {
-                RFLOAT d = NORM_3(x, y, z);
-
-                if (d < ew)
-                {
-                    int index = distance.iRL(i + x, j + y, k + z);
-                    omp_set_lock(&mtx[index]);
-                    if (distance(index) > d) distance(index) = d;
-                    omp_unset_lock(&mtx[index]);
-                }
-            }
+    int nSlab = GSL_MIN_INT(nThread, nSlc);
+
+    // each slab is united by its own thread, touching only its own voxels
+    #pragma omp parallel for num_threads(nThread)
+    for (int t = 0; t < nSlab; t++)
+    {
+        int kBegin = nSlc * t / nSlab;
+        int kEnd = nSlc * (t + 1) / nSlab;
+
+        for (int k = kBegin; k < kEnd; k++)
+        {
+            uniteSlice(parent, k, nCol, nRow);
+
+            int kn = nextVoxel(k, nSlc);
+
+            if ((kn != -1) && (kn >= kBegin) && (kn < kEnd))
+                uniteSlices(parent, k, kn, nCol, nRow);
+        }
+    }
+
+    // merge the slabs along their boundaries
+    for (int t = 0; t < nSlab; t++)
+    {
+        int kBegin = nSlc * t / nSlab;
+        int kEnd = nSlc * (t + 1) / nSlab;
+
+        int k = kEnd - 1;
+        int kn = nextVoxel(k, nSlc);
+
+        if ((kn != -1) && ((kn < kBegin) || (kn >= kEnd)))
+            uniteSlices(parent, k, kn, nCol, nRow);
+    }
+
+    // a parent precedes its child, so a single pass in order replaces the
+    // parents by the labels of the roots
+    int nComponent = 0;
+
+    size.clear();
+
+    for (int i = 0; i < n; i++)
+    {
+        if (parent[i] < 0) continue;
+
+        if (parent[i] == i)
+        {
+            parent[i] = nComponent++;
+            size.push_back(0);
+        }
+        else
+            parent[i] = parent[parent[i]];
+
+        size[parent[i]] += 1;
+    }
+
+    return nComponent;
+}
+
+static bool sizeGreater(const std::pair<size_t, int>& a,
+                        const std::pair<size_t, int>& b)
+{
+    return a.first > b.first;
+}
+
+void filterComponent(Volume& vol,
+                     const int nKeep,
+                     const size_t minSize,
+                     const unsigned int nThread)
+{
+    vector<int> label;
+    vector<size_t> size;
+
+    int nComponent = labelComponent(label, size, vol, nThread);
+
+    vector<std::pair<size_t, int> > order(nComponent);
+
+    for (int i = 0; i < nComponent; i++)
+        order[i] = std::make_pair(size[i], i);
+
+    std::stable_sort(order.begin(), order.end(), sizeGreater);
+
+    vector<char> keep(nComponent, 0);
+
+    for (int i = 0; i < nComponent; i++)
+        if (((nKeep <= 0) || (i < nKeep)) &&
+            (order[i].first >= minSize))
+            keep[order[i].second] = 1;
+
+    #pragma omp parallel for num_threads(nThread)
+    FOR_EACH_PIXEL_RL(vol)
+        if ((label[i] >= 0) && !keep[label[i]])
+            vol(i) = 0;
+}
+
+void extMask(Volume& vol,
+             const RFLOAT ext,
+             const unsigned int nThread)
+{
+    if (ext == 0) return;
+
+    Volume distance;
+
+    // extending reaches out from the voxels of 1, shrinking from the voxels of 0
+    distanceTransform(distance, vol, (ext > 0) ? 1 : 0, nThread);
+
+    RFLOAT ext2 = TSGSL_pow_2(ext);
 
     #pragma omp parallel for num_threads(nThread)
-    for (int i = 0; i < (int)vol.sizeRL(); i++)
-        omp_destroy_lock(&mtx[i]);
+    FOR_EACH_PIXEL_RL(vol)
+        if (distance(i) < ext2)
+            vol(i) = (ext > 0) ? 1 : 0;
+}
 
-    delete[] mtx;
+void softEdge(Volume& vol,
+              const RFLOAT ew,
+              const unsigned int nThread)
+{
+    Volume distance;
 
-    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
+    distanceTransform(distance, vol, 1, nThread);
+
+    #pragma omp parallel for num_threads(nThread)
     FOR_EACH_PIXEL_RL(vol)
     {
         RFLOAT d = distance(i);
+
+        if (d == FLT_MAX) continue;
+
+        d = sqrt(d);
+
         if ((d != 0) && (d < ew))
             vol(i) = 0.5 + 0.5 * cos(d / ew * M_PI);
     }
@@ -703,8 +973,7 @@ void genMask(Volume& dst,
         else
             dst.setRL(0, i, j, k);
 
-    // remove isolated point
-    removeIsolatedPoint(dst, nThread);
+    filterComponent(dst, GEN_MASK_N_COMPONENT, GEN_MASK_MIN_COMPONENT, nThread);
 }
 
 void genMask(Volume& dst,
@@ -730,6 +999,29 @@ void genMask(Volume& dst,
     softEdge(dst, ew, nThread);
 }
 
+void genMask(Volume& dst,
+             const Volume& src,
+             const RFLOAT thres,
+             const RFLOAT ext,
+             const RFLOAT ew,
+             const int nKeep,
+             const size_t minSize,
+             const unsigned int nThread)
+{
+    #pragma omp parallel for num_threads(nThread)
+    VOLUME_FOR_EACH_PIXEL_RL(src)
+        if (src.getRL(i, j, k) > thres)
+            dst.setRL(1, i, j, k);
+        else
+            dst.setRL(0, i, j, k);
+
+    filterComponent(dst, nKeep, minSize, nThread);
+
+    extMask(dst, ext, nThread);
+
+    softEdge(dst, ew, nThread);
+}
+
 void autoMask(Volume& dst,
               const Volume& src,
               const RFLOAT r,
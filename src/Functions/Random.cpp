@@ -18,8 +18,108 @@
 #include <stdint.h>
 #include <unistd.h>
 
+#include <gsl/gsl_math.h>
+
 namespace
 {
+    /**
+     * global random seed, 0 for seeding each engine from /dev/urandom
+     */
+    unsigned long globalSeed = 0;
+
+    struct PhiloxState
+    {
+        uint32_t key[2];
+
+        uint32_t ctr[4];
+
+        uint32_t out[4];
+
+        int idx;
+    };
+
+    inline void philoxRound(uint32_t* ctr,
+                            const uint32_t* key)
+    {
+        uint64_t p0 = (uint64_t)0xD2511F53 * ctr[0];
+        uint64_t p1 = (uint64_t)0xCD9E8D57 * ctr[2];
+
+        uint32_t c0 = (uint32_t)(p1 >> 32) ^ ctr[1] ^ key[0];
+        uint32_t c2 = (uint32_t)(p0 >> 32) ^ ctr[3] ^ key[1];
+
+        ctr[1] = (uint32_t)p1;
+        ctr[3] = (uint32_t)p0;
+        ctr[0] = c0;
+        ctr[2] = c2;
+    }
+
+    inline void philoxBlock(PhiloxState* s)
+    {
+        uint32_t key[2] = {s->key[0], s->key[1]};
+
+        for (int i = 0; i < 4; i++)
+            s->out[i] = s->ctr[i];
+
+        for (int r = 0; r < 10; r++)
+        {
+            if (r > 0)
+            {
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+
+            philoxRound(s->out, key);
+        }
+
+        // the first word of the counter indexes blocks inside a stream, the
+        // other three words are left to the caller for keying the stream
+        s->ctr[0]++;
+
+        s->idx = 0;
+    }
+
+    inline uint32_t philoxNext(PhiloxState* s)
+    {
+        if (s->idx == 4) philoxBlock(s);
+
+        return s->out[s->idx++];
+    }
+
+    void philoxSet(void* state,
+                   unsigned long seed)
+    {
+        PhiloxState* s = static_cast<PhiloxState*>(state);
+
+        s->key[0] = (uint32_t)seed;
+        s->key[1] = (uint32_t)((uint64_t)seed >> 32);
+
+        for (int i = 0; i < 4; i++)
+            s->ctr[i] = 0;
+
+        s->idx = 4;
+    }
+
+    unsigned long philoxGet(void* state)
+    {
+        return philoxNext(static_cast<PhiloxState*>(state));
+    }
+
+    double philoxGetDouble(void* state)
+    {
+        return philoxNext(static_cast<PhiloxState*>(state)) / 4294967296.0;
+    }
+
+    const gsl_rng_type philoxType =
+    {
+        "philox4x32",
+        0xffffffffUL,
+        0,
+        sizeof(PhiloxState),
+        &philoxSet,
+        &philoxGet,
+        &philoxGetDouble
+    };
+
     class ThreadLocalRNG
     {
         private:
@@ -52,15 +152,20 @@ namespace
             {
                 gsl_rng* engine = static_cast<gsl_rng*>(pthread_getspecific(key));
 
-                if (engine) return engine;
+                // an engine allocated before the global seed changed is of
+                // the wrong type and has to be replaced
+                if (engine && ((engine->type == &philoxType) == (globalSeed != 0)))
+                    return engine;
+
+                if (engine) TSGSL_rng_free(engine);
 
-                engine = TSGSL_rng_alloc(gsl_rng_mt19937);
+                engine = TSGSL_rng_alloc(globalSeed ? &philoxType : gsl_rng_mt19937);
 
                 if (!engine) CLOG(FATAL, "LOGGER_SYS") << "Failure to allocate Random Engine";
 
-                unsigned long seed;
+                unsigned long seed = globalSeed;
 
-                (void)(seed_from_urandom(&seed) || seed_from_time(&seed));
+                if (!seed) (void)(seed_from_urandom(&seed) || seed_from_time(&seed));
 
                 TSGSL_rng_set(engine, seed);
 
@@ -100,8 +205,77 @@ namespace
     };
 }
 
+const gsl_rng_type* gsl_rng_philox4x32 = &philoxType;
+
+void set_random_seed(const unsigned long seed)
+{
+    globalSeed = seed;
+}
+
 gsl_rng* get_random_engine()
 {
     static ThreadLocalRNG rng;
     return rng.get();
 }
+
+void seed_random_engine(const int iter,
+                        const int id,
+                        const int phase)
+{
+    if (!globalSeed) return;
+
+    PhiloxState* s = static_cast<PhiloxState*>(get_random_engine()->state);
+
+    philoxSet(s, globalSeed);
+
+    s->ctr[1] = (uint32_t)phase;
+    s->ctr[2] = (uint32_t)id;
+    s->ctr[3] = (uint32_t)iter;
+}
+
+void random_uniform_batch(double* dst,
+                          const size_t n,
+                          const gsl_rng* engine)
+{
+    if (engine->type == &philoxType)
+    {
+        PhiloxState* s = static_cast<PhiloxState*>(engine->state);
+
+        for (size_t i = 0; i < n; i++)
+            dst[i] = philoxNext(s) / 4294967296.0;
+    }
+    else
+    {
+        for (size_t i = 0; i < n; i++)
+            dst[i] = gsl_rng_uniform(engine);
+    }
+}
+
+void random_gaussian_batch(double* dst,
+                           const size_t n,
+                           const double sigma,
+                           const gsl_rng* engine)
+{
+    if (engine->type == &philoxType)
+    {
+        PhiloxState* s = static_cast<PhiloxState*>(engine->state);
+
+        for (size_t i = 0; i < n; i += 2)
+        {
+            // u0 in (0, 1) keeps the logarithm finite
+            double u0 = (philoxNext(s) + 0.5) / 4294967296.0;
+            double u1 = philoxNext(s) / 4294967296.0;
+
+            double r = sigma * sqrt(-2 * log(u0));
+
+            dst[i] = r * cos(2 * M_PI * u1);
+
+            if (i + 1 < n) dst[i + 1] = r * sin(2 * M_PI * u1);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < n; i++)
+            dst[i] = gsl_ran_gaussian(engine, sigma);
+    }
+}
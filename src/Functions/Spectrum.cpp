@@ -48,17 +48,17 @@ RFLOAT ringAverage(const int resP,
                    const Image& img,
                    const function<RFLOAT(const Complex)> func)
 {
-    RFLOAT result = 0;
-    int counter = 0;
+    dvec sum;
 
-    IMAGE_FOR_EACH_PIXEL_FT(img)
-        if (AROUND(NORM(i, j)) == resP)
-        {
-            result += func(img.getFT(i, j));
-            counter++;
-        }
+    shellReduce(sum,
+                ShellSumFunc<function<RFLOAT(const Complex)> >(img.dataFT(), func),
+                img.nColRL(),
+                img.nRowRL(),
+                1,
+                resP + 1,
+                1);
 
-    return result / counter;
+    return sum(resP) / sum(resP + 1 + resP);
 }
 
 Complex ringAverage(const int resP,
@@ -83,26 +83,40 @@ void ringAverage(vec& dst,
                  const function<RFLOAT(const Complex)> func,
                  const int r)
 {
+    dvec sum;
+
+    shellReduce(sum,
+                ShellSumFunc<function<RFLOAT(const Complex)> >(src.dataFT(), func),
+                src.nColRL(),
+                src.nRowRL(),
+                1,
+                r,
+                1);
+
     dst.setZero();
 
-    uvec counter = uvec::Zero(dst.size());
+    for (int i = 0; i < r; i++)
+        dst(i) = sum(i) / sum(r + i);
+}
 
-    IMAGE_FOR_EACH_PIXEL_FT(src)
-    {
-        if (QUAD(i, j) < TSGSL_pow_2(r))
-        {
-            int u = AROUND(NORM(i, j));
+void ringAverage(vec& dst,
+                 const RealFTVolume& src,
+                 const int r)
+{
+    dvec sum;
 
-            if (u < r)
-            {
-                dst(u) += func(src.getFTHalf(i, j));
-                counter(u) += 1;
-            }
-        }
-    }
+    shellReduce(sum,
+                ShellSum(src.dataFT()),
+                src.nColRL(),
+                src.nRowRL(),
+                1,
+                r,
+                1);
+
+    dst.setZero();
 
     for (int i = 0; i < r; i++)
-        dst(i) /= counter(i);
+        dst(i) = sum(i) / sum(r + i);
 }
 
 RFLOAT shellAverage(const int resP,
@@ -110,20 +124,17 @@ RFLOAT shellAverage(const int resP,
                     const function<RFLOAT(const Complex)> func,
                     const unsigned int nThread)
 {
-    RFLOAT result = 0;
-    int counter = 0;
+    dvec sum;
 
-    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-    VOLUME_FOR_EACH_PIXEL_FT(vol)
-        if (AROUND(NORM_3(i, j, k)) == resP)
-        {
-            #pragma omp atomic
-            result += func(vol.getFT(i, j, k));
-            #pragma omp atomic
-            counter++;
-        }
+    shellReduce(sum,
+                ShellSumFunc<function<RFLOAT(const Complex)> >(vol.dataFT(), func),
+                vol.nColRL(),
+                vol.nRowRL(),
+                vol.nSlcRL(),
+                resP + 1,
+                nThread);
 
-    return result / counter;
+    return sum(resP) / sum(resP + 1 + resP);
 }
 
 void shellAverage(vec& dst,
@@ -132,30 +143,41 @@ void shellAverage(vec& dst,
                   const int r,
                   const unsigned int nThread)
 {
+    dvec sum;
+
+    shellReduce(sum,
+                ShellSumFunc<function<RFLOAT(const Complex)> >(src.dataFT(), func),
+                src.nColRL(),
+                src.nRowRL(),
+                src.nSlcRL(),
+                r,
+                nThread);
+
     dst.setZero();
 
-    uvec counter = uvec::Zero(dst.size());
+    for (int i = 0; i < r; i++)
+        dst(i) = sum(i) / sum(r + i);
+}
 
-    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-    VOLUME_FOR_EACH_PIXEL_FT(src)
-    {
-        if (QUAD_3(i, j, k) < TSGSL_pow_2(r))
-        {
-            int u = AROUND(NORM_3(i, j, k));
-
-            if (u < r)
-            {
-                #pragma omp atomic
-                dst(u) += func(src.getFTHalf(i, j, k));
-                #pragma omp atomic
-                counter(u) += 1;
-            }
-        }
-    }
+void shellAverage(vec& dst,
+                  const RealFTVolume& src,
+                  const int r,
+                  const unsigned int nThread)
+{
+    dvec sum;
+
+    shellReduce(sum,
+                ShellSum(src.dataFT()),
+                src.nColRL(),
+                src.nRowRL(),
+                src.nSlcRL(),
+                r,
+                nThread);
+
+    dst.setZero();
 
-    #pragma omp parallel for num_threads(nThread)
     for (int i = 0; i < r; i++)
-        dst(i) /= counter(i);
+        dst(i) = sum(i) / sum(r + i);
 }
 
 void powerSpectrum(vec& dst,
@@ -163,30 +185,20 @@ void powerSpectrum(vec& dst,
                    const int r,
                    const unsigned int nThread)
 {
-    dst.setZero();
+    dvec sum;
 
-    uvec counter = uvec::Zero(dst.size());
+    shellReduce(sum,
+                ShellSumAbs2(src.dataFT()),
+                src.nColRL(),
+                src.nRowRL(),
+                1,
+                r,
+                nThread);
 
-    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-    IMAGE_FOR_EACH_PIXEL_FT(src)
-    {
-        if (QUAD(i, j) < TSGSL_pow_2(r))
-        {
-            int u = AROUND(NORM(i, j));
-
-            if (u < r)
-            {
-                #pragma omp atomic
-                dst(u) += ABS2(src.getFT(i, j));
-                #pragma omp atomic
-                counter(u) += 1;
-            }
-        }
-    }
+    dst.setZero();
 
-    #pragma omp parallel for num_threads(nThread)
     for (int i = 0; i < r; i++)
-        dst(i) /= counter(i);
+        dst(i) = sum(i) / sum(r + i);
 }
 
 void powerSpectrum(vec& dst,
@@ -194,30 +206,37 @@ void powerSpectrum(vec& dst,
                    const int r,
                    const unsigned int nThread)
 {
+    dvec sum;
+
+    shellReduce(sum,
+                ShellSumAbs2(src.dataFT()),
+                src.nColRL(),
+                src.nRowRL(),
+                src.nSlcRL(),
+                r,
+                nThread);
+
     dst.setZero();
 
-    uvec counter = uvec::Zero(dst.size());
+    for (int i = 0; i < r; i++)
+        dst(i) = sum(i) / sum(r + i);
+}
 
-    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-    VOLUME_FOR_EACH_PIXEL_FT(src)
-    {
-        if (QUAD_3(i, j, k) < TSGSL_pow_2(r))
-        {
-            int u = AROUND(NORM_3(i, j, k));
-
-            if (u < r)
-            {
-                #pragma omp atomic
-                dst(u) += ABS2(src.getFT(i, j, k));
-                #pragma omp atomic
-                counter(u) += 1;
-            }
-        }
-    }
+static void FSCFromSum(vec& dst,
+                       const dvec& sum,
+                       const int offset = 0)
+{
+    int r = dst.size();
 
-    #pragma omp parallel for num_threads(nThread)
     for (int i = 0; i < r; i++)
-        dst(i) /= counter(i);
+    {
+        double AB = sqrt(sum((offset + 1) * r + i) * sum((offset + 2) * r + i));
+
+        if (AB == 0)
+            dst(i) = 0;
+        else
+            dst(i) = sum(offset * r + i) / AB;
+    }
 }
 
 void FRC(vec& dst,
@@ -229,29 +248,17 @@ void FRC(vec& dst,
     SEGMENT_NAN_CHECK_COMPLEX(B.dataFT(), B.sizeFT());
 #endif
 
-    vec vecS = vec::Zero(dst.size());
-    vec vecA = vec::Zero(dst.size());
-    vec vecB = vec::Zero(dst.size());
+    dvec sum;
 
-    IMAGE_FOR_EACH_PIXEL_FT(A)
-    {
-        int u = AROUND(NORM(i, j));
-        if (u < dst.size())
-        {
-            vecS[u] += REAL(A.getFT(i, j) * CONJUGATE(B.getFT(i, j)));
-            vecA[u] += ABS2(A.getFT(i, j));
-            vecB[u] += ABS2(B.getFT(i, j));
-        }
-    }
+    shellReduce(sum,
+                ShellSumFSC(A.dataFT(), B.dataFT()),
+                A.nColRL(),
+                A.nRowRL(),
+                1,
+                dst.size(),
+                1);
 
-    for (int i = 0; i < dst.size(); i++)
-    {
-        RFLOAT AB = sqrt(vecA(i) * vecB(i));
-        if (AB == 0)
-            dst(i) = 0;
-        else
-            dst(i) = vecS(i) / AB;
-    }
+    FSCFromSum(dst, sum);
 }
 
 void FRC(vec& dst,
@@ -264,39 +271,20 @@ void FRC(vec& dst,
     SEGMENT_NAN_CHECK_COMPLEX(B.dataFT(), B.sizeFT());
 #endif
 
-    vec vecS = vec::Zero(dst.size());
-    vec vecA = vec::Zero(dst.size());
-    vec vecB = vec::Zero(dst.size());
+    // the k-th slice is walked as an image
+    size_t slice = A.iFTHalf(0, 0, k);
 
-    /***
-    for (int j = -A.nRowRL() / 2; j < A.nRowRL() / 2; j++)
-        for (int i = 0; i <= A.nColRL() / 2; i++)
-    ***/
-    IMAGE_FOR_EACH_PIXEL_FT(A)
-        {
-            int u = AROUND(NORM(i, j));
-            if (u < dst.size())
-            {
-                vecS[u] += REAL(A.getFT(i, j, k) * CONJUGATE(B.getFT(i, j, k)));
-                vecA[u] += ABS2(A.getFT(i, j, k));
-                vecB[u] += ABS2(B.getFT(i, j, k));
-            }
-        }
+    dvec sum;
 
-    /***
-    std::cout << "vecS = " << vecS << std::endl;
-    std::cout << "vecA = " << vecA << std::endl;
-    std::cout << "vecB = " << vecB << std::endl;
-    ***/
+    shellReduce(sum,
+                ShellSumFSC(A.dataFT() + slice, B.dataFT() + slice),
+                A.nColRL(),
+                A.nRowRL(),
+                1,
+                dst.size(),
+                1);
 
-    for (int i = 0; i < dst.size(); i++)
-    {
-        RFLOAT AB = sqrt(vecA(i) * vecB(i));
-        if (AB == 0)
-            dst(i) = 0;
-        else
-            dst(i) = vecS(i) / AB;
-    }
+    FSCFromSum(dst, sum);
 }
 
 void FSC(vec& dst,
@@ -304,36 +292,39 @@ void FSC(vec& dst,
          const Volume& B,
          const unsigned int nThread)
 {
-    vec vecS = vec::Zero(dst.size());
-    vec vecA = vec::Zero(dst.size());
-    vec vecB = vec::Zero(dst.size());
+    dvec sum;
 
-    #pragma omp parallel for schedule(dynamic) num_threads(nThread)
-    VOLUME_FOR_EACH_PIXEL_FT(A)
-    {
-        int u = AROUND(NORM_3(i, j, k));
+    shellReduce(sum,
+                ShellSumFSC(A.dataFT(), B.dataFT()),
+                A.nColRL(),
+                A.nRowRL(),
+                A.nSlcRL(),
+                dst.size(),
+                nThread);
 
-        if (u < dst.size())
-        {
-            #pragma omp atomic
-            vecS[u] += REAL(A.getFTHalf(i, j, k) * CONJUGATE(B.getFTHalf(i, j, k)));
-            #pragma omp atomic
-            vecA[u] += ABS2(A.getFTHalf(i, j, k));
-            #pragma omp atomic
-            vecB[u] += ABS2(B.getFTHalf(i, j, k));
-        }
-    }
-
-    #pragma omp parallel for num_threads(nThread)
-    for (int i = 0; i < dst.size(); i++)
-    {
-        RFLOAT AB = sqrt(vecA(i) * vecB(i));
+    FSCFromSum(dst, sum);
+}
 
-        if (AB == 0)
-            dst(i) = 0;
-        else
-            dst(i) = vecS(i) / AB;
-    }
+void FSC(vec& dstAB,
+         vec& dstCD,
+         const Volume& A,
+         const Volume& B,
+         const Volume& C,
+         const Volume& D,
+         const unsigned int nThread)
+{
+    dvec sum;
+
+    shellReduce(sum,
+                ShellSumFSCPair(A.dataFT(), B.dataFT(), C.dataFT(), D.dataFT()),
+                A.nColRL(),
+                A.nRowRL(),
+                A.nSlcRL(),
+                dstAB.size(),
+                nThread);
+
+    FSCFromSum(dstAB, sum);
+    FSCFromSum(dstCD, sum, 3);
 }
 
 int resP(const vec& fsc,
@@ -419,19 +410,19 @@ void bFactorEst(RFLOAT& bFactor,
     vec I = vec::Zero(rU - rL);
     vec C = vec::Zero(rU - rL);
 
-    VOLUME_FOR_EACH_PIXEL_FT(vol)
-    {
-        int u = AROUND(NORM_3(i, j, k));
-        if ((u < rU) && (u >= rL))
-        {
-            I[u - rL] += ABS(vol.getFT(i, j, k));
-            C[u - rL] += 1;
-        }
-    }
-    
+    dvec sum;
+
+    shellReduce(sum,
+                ShellSumAbs(vol.dataFT()),
+                vol.nColRL(),
+                vol.nRowRL(),
+                vol.nSlcRL(),
+                rU,
+                1);
+
     for (int i = 0; i < rU - rL; i++)
     {
-        I[i] = log(I[i] / C[i]);
+        I[i] = log(sum(i + rL) / sum(rU + i + rL));
         C[i] = TSGSL_pow_2((RFLOAT)(i + rL) / vol.nColRL());
     }
 
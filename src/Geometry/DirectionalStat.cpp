@@ -61,18 +61,30 @@ void sampleACG(dmat4& dst,
     }
 }
 
+// For a diagonal parameter matrix, the L*LT decomposition is simply the square
+// root of the diagonal. The Gaussian variates are drawn in the same order as
+// the general version, then scaled column by column and normalised at once.
+static void sampleACGDiag(dmat4& dst,
+                          const dvec4& l,
+                          const int n)
+{
+    gsl_rng* engine = get_random_engine();
+
+    Matrix<double, Dynamic, 4, RowMajor> g(n, 4);
+
+    random_gaussian_batch(g.data(), 4 * n, 1, engine);
+
+    dst.topRows(n) = g * l.asDiagonal();
+
+    dst.topRows(n).array().colwise() /= dst.topRows(n).rowwise().norm().array();
+}
+
 void sampleACG(dmat4& dst,
                const double k0,
                const double k1,
                const int n)
 {
-    dmat44 src;
-    src << k0, 0, 0, 0,
-           0, k1, 0, 0,
-           0, 0, k1, 0,
-           0, 0, 0, k1;
-
-    sampleACG(dst, src, n);
+    sampleACGDiag(dst, dvec4(sqrt(k0), sqrt(k1), sqrt(k1), sqrt(k1)), n);
 }
 
 void sampleACG(dmat4& dst,
@@ -81,13 +93,7 @@ void sampleACG(dmat4& dst,
                const double k3,
                const int n)
 {
-    dmat44 src;
-    src << 1, 0, 0, 0,
-           0, k1, 0, 0,
-           0, 0, k2, 0,
-           0, 0, 0, k3;
-
-    sampleACG(dst, src, n);
+    sampleACGDiag(dst, dvec4(1, sqrt(k1), sqrt(k2), sqrt(k3)), n);
 }
 
 void inferACG(dmat44& dst,
@@ -100,24 +106,15 @@ void inferACG(dmat44& dst,
     {
         A = B;
 
-        B = dmat44::Zero();
-        double nf = 0;
-
-        for (int i = 0; i < src.rows(); i++)
-        {
-            // get the tensor product of the i-th quaternion and itself
-            dmat44 tensor;
-            for (int j = 0; j < 4; j++)
-                for (int k = 0; k < 4; k++)
-                    tensor(j, k) = src(i, j) * src(i, k);
+        // get the factor of each quaternion, u_i = q_i^T * A^-1 * q_i
+        dvec u = (src * A.inverse()).cwiseProduct(src).rowwise().sum();
 
-            // get the factor
-            double u = src.row(i) * A.inverse() * src.row(i).transpose();
+        dvec uRcp = u.cwiseInverse();
 
-            B += tensor / u;
+        double nf = uRcp.sum();
 
-            nf += 1.0 / u;
-        }
+        // weighted sum of the tensor products of each quaternion and itself
+        B = src.transpose() * uRcp.asDiagonal() * src;
 
         B *= 4.0 / nf;
 
@@ -25,6 +25,69 @@ void quaternion_mul(dvec4& dst,
     dst[3] = z;
 }
 
+void quaternion_mul(dmat4& dst,
+                    const dmat4& a,
+                    const dvec4& b)
+{
+    dvec w = a.col(0) * b[0] - a.col(1) * b[1] - a.col(2) * b[2] - a.col(3) * b[3];
+    dvec x = a.col(0) * b[1] + a.col(1) * b[0] + a.col(2) * b[3] - a.col(3) * b[2];
+    dvec y = a.col(0) * b[2] - a.col(1) * b[3] + a.col(2) * b[0] + a.col(3) * b[1];
+    dvec z = a.col(0) * b[3] + a.col(1) * b[2] - a.col(2) * b[1] + a.col(3) * b[0];
+
+    dst.resize(a.rows(), 4);
+
+    dst.col(0) = w;
+    dst.col(1) = x;
+    dst.col(2) = y;
+    dst.col(3) = z;
+}
+
+void quaternion_mul(dmat4& dst,
+                    const dvec4& a,
+                    const dmat4& b)
+{
+    dvec w = a[0] * b.col(0) - a[1] * b.col(1) - a[2] * b.col(2) - a[3] * b.col(3);
+    dvec x = a[0] * b.col(1) + a[1] * b.col(0) + a[2] * b.col(3) - a[3] * b.col(2);
+    dvec y = a[0] * b.col(2) - a[1] * b.col(3) + a[2] * b.col(0) + a[3] * b.col(1);
+    dvec z = a[0] * b.col(3) + a[1] * b.col(2) - a[2] * b.col(1) + a[3] * b.col(0);
+
+    dst.resize(b.rows(), 4);
+
+    dst.col(0) = w;
+    dst.col(1) = x;
+    dst.col(2) = y;
+    dst.col(3) = z;
+}
+
+void quaternion_mul(dmat4& dst,
+                    const dmat4& a,
+                    const dmat4& b)
+{
+    dvec w = (a.col(0).array() * b.col(0).array()
+            - a.col(1).array() * b.col(1).array()
+            - a.col(2).array() * b.col(2).array()
+            - a.col(3).array() * b.col(3).array()).matrix();
+    dvec x = (a.col(0).array() * b.col(1).array()
+            + a.col(1).array() * b.col(0).array()
+            + a.col(2).array() * b.col(3).array()
+            - a.col(3).array() * b.col(2).array()).matrix();
+    dvec y = (a.col(0).array() * b.col(2).array()
+            - a.col(1).array() * b.col(3).array()
+            + a.col(2).array() * b.col(0).array()
+            + a.col(3).array() * b.col(1).array()).matrix();
+    dvec z = (a.col(0).array() * b.col(3).array()
+            + a.col(1).array() * b.col(2).array()
+            - a.col(2).array() * b.col(1).array()
+            + a.col(3).array() * b.col(0).array()).matrix();
+
+    dst.resize(a.rows(), 4);
+
+    dst.col(0) = w;
+    dst.col(1) = x;
+    dst.col(2) = y;
+    dst.col(3) = z;
+}
+
 dvec4 quaternion_conj(const dvec4& quat)
 {
     dvec4 conj;
@@ -334,6 +334,35 @@ void symmetryCounterpart(dvec4& dst,
     dst = q;
 }
 
+void symmetryCounterpart(dmat4& dst,
+                         const Symmetry& sym,
+                         const dvec4* anchor)
+{
+    if (anchor == NULL) anchor = &ANCHOR_POINT_2;
+
+    dmat4 q = dst;
+
+    vec s = (dst * (*anchor)).cwiseAbs().cast<RFLOAT>();
+
+    dmat4 p;
+
+    for (int i = 0; i < sym.nSymmetryElement(); i++)
+    {
+        quaternion_mul(p, quaternion_conj(sym.quat(i)), dst);
+
+        vec t = (p * (*anchor)).cwiseAbs().cast<RFLOAT>();
+
+        for (int j = 0; j < dst.rows(); j++)
+            if (t(j) > s(j))
+            {
+                s(j) = t(j);
+                q.row(j) = p.row(j);
+            }
+    }
+
+    dst = q;
+}
+
 void symmetryRotation(vector<dmat33>& sr,
                       const dmat33 rot,
                       const Symmetry* sym)
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description:
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#include "AsyncWriter.h"
+
+AsyncWriter::AsyncWriter() : _nPending(0),
+                             _running(false),
+                             _stop(false)
+{
+    pthread_mutex_init(&_mutex, NULL);
+    pthread_cond_init(&_queueCond, NULL);
+    pthread_cond_init(&_doneCond, NULL);
+}
+
+AsyncWriter::~AsyncWriter()
+{
+    pthread_mutex_lock(&_mutex);
+
+    bool running = _running;
+
+    _stop = true;
+
+    pthread_cond_signal(&_queueCond);
+
+    pthread_mutex_unlock(&_mutex);
+
+    // the writer thread drains the queue before stopping
+    if (running) pthread_join(_thread, NULL);
+
+    pthread_cond_destroy(&_doneCond);
+    pthread_cond_destroy(&_queueCond);
+    pthread_mutex_destroy(&_mutex);
+}
+
+void AsyncWriter::submit(Job* job)
+{
+    pthread_mutex_lock(&_mutex);
+
+    if (!_running)
+    {
+        if (pthread_create(&_thread, NULL, run, this) == 0)
+            _running = true;
+        else
+        {
+            pthread_mutex_unlock(&_mutex);
+
+            CLOG(WARNING, "LOGGER_SYS") << "Fail To Start The Writer Thread, Writing Synchronously";
+
+            job->write();
+
+            delete job;
+
+            return;
+        }
+    }
+
+    _queue.push_back(job);
+
+    _nPending++;
+
+    pthread_cond_signal(&_queueCond);
+
+    pthread_mutex_unlock(&_mutex);
+}
+
+void AsyncWriter::wait()
+{
+    pthread_mutex_lock(&_mutex);
+
+    while (_nPending > 0)
+        pthread_cond_wait(&_doneCond, &_mutex);
+
+    pthread_mutex_unlock(&_mutex);
+}
+
+void* AsyncWriter::run(void* arg)
+{
+    AsyncWriter* writer = (AsyncWriter*)arg;
+
+    while (true)
+    {
+        pthread_mutex_lock(&writer->_mutex);
+
+        while (writer->_queue.empty() && !writer->_stop)
+            pthread_cond_wait(&writer->_queueCond, &writer->_mutex);
+
+        if (writer->_queue.empty())
+        {
+            // stopped and drained
+            pthread_mutex_unlock(&writer->_mutex);
+
+            break;
+        }
+
+        Job* job = writer->_queue.front();
+
+        writer->_queue.pop_front();
+
+        pthread_mutex_unlock(&writer->_mutex);
+
+        job->write();
+
+        delete job;
+
+        pthread_mutex_lock(&writer->_mutex);
+
+        if (--writer->_nPending == 0)
+            pthread_cond_broadcast(&writer->_doneCond);
+
+        pthread_mutex_unlock(&writer->_mutex);
+    }
+
+    return NULL;
+}
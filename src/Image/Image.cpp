@@ -346,25 +346,10 @@ Complex Image::getByInterpolationFT(RFLOAT iCol,
                                     RFLOAT iRow,
                                     const int interp) const
 {
-    bool conj = conjHalf(iCol, iRow);
-
     if (interp == NEAREST_INTERP)
-    {
-        Complex result = getFTHalf(AROUND(iCol), AROUND(iRow));
-
-        return conj ? CONJUGATE(result) : result;
-    }
-
-    RFLOAT w[2][2];
-    long x0[2];
-    RFLOAT x[2] = {iCol, iRow};
-
-    //WG_BI_INTERP(w, x0, x, interp);
-    WG_BI_INTERP_LINEAR(w, x0, x);
-
-    Complex result = getFTHalf(w, x0);
-
-    return conj ? CONJUGATE(result) : result;
+        return getByInterpolationFT<NEAREST_INTERP>(iCol, iRow);
+    else
+        return getByInterpolationFT<LINEAR_INTERP>(iCol, iRow);
 }
 
 void Image::addFT(const Complex value,
@@ -401,6 +386,26 @@ void Image::addFT(const RFLOAT value,
     addFTHalf(value, w, x0);
 }
 
+void Image::addFT(const Complex value,
+                  const RFLOAT iCol,
+                  const RFLOAT iRow,
+                  const RFLOAT a,
+                  const TabFunction& kernel)
+{
+    RFLOAT a2 = TSGSL_pow_2(a);
+
+    for (long j = GSL_MAX_INT(-_nRow / 2, FLOOR(iRow - a));
+              j <= GSL_MIN_INT(_nRow / 2 - 1, CEIL(iRow + a));
+              j++)
+        for (long i = GSL_MAX_INT(-_nCol / 2, FLOOR(iCol - a));
+                  i <= GSL_MIN_INT(_nCol / 2, CEIL(iCol + a));
+                  i++)
+        {
+            RFLOAT r2 = QUAD(iCol - i, iRow - j);
+            if (r2 < a2) addFT(value * kernel(r2), i, j);
+        }
+}
+
 void Image::clear()
 {
     ImageBase::clear();
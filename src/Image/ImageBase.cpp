@@ -15,6 +15,7 @@ ImageBase::ImageBase() : _sizeRL(0), _sizeFT(0)
 #ifdef FFTW_PTR
     _dataRL = NULL;
     _dataFT = NULL;
+    _ownFT = true;
 #endif
 }
 
@@ -46,7 +47,7 @@ ImageBase::~ImageBase()
         _dataRL = NULL;
     }
 
-    if (_dataFT != NULL)
+    if ((_dataFT != NULL) && _ownFT)
     {
 #ifdef FFTW_PTR_THREAD_SAFETY
         #pragma omp critical  (line54)
@@ -67,6 +68,7 @@ void ImageBase::swap(ImageBase& that)
 #ifdef FFTW_PTR
     std::swap(_dataRL, that._dataRL);
     std::swap(_dataFT, that._dataFT);
+    std::swap(_ownFT, that._ownFT);
 #endif
 
     std::swap(_sizeRL, that._sizeRL);
@@ -121,16 +123,30 @@ void ImageBase::clearFT()
 #ifdef FFTW_PTR
     if (_dataFT != NULL)
     {
+        if (_ownFT)
+        {
 #ifdef FFTW_PTR_THREAD_SAFETY
-        #pragma omp critical (line127)
+            #pragma omp critical (line127)
 #endif
-        TSFFTW_free(_dataFT);
+            TSFFTW_free(_dataFT);
+        }
 
         _dataFT = NULL;
+        _ownFT = true;
     }
 #endif
 }
 
+#ifdef FFTW_PTR
+void ImageBase::attachFT(Complex* data)
+{
+    clearFT();
+
+    _dataFT = data;
+    _ownFT = false;
+}
+#endif
+
 void ImageBase::copyBase(ImageBase& other) const
 {
     other._sizeRL = _sizeRL;
@@ -179,6 +195,8 @@ void ImageBase::copyBase(ImageBase& other) const
 #endif
         other._dataFT = (Complex*)TSFFTW_malloc(_sizeFT * sizeof(Complex));
         memcpy(other._dataFT, _dataFT, _sizeFT * sizeof(Complex));
+
+        other._ownFT = true;
 #endif
     }
     else
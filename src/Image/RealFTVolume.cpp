@@ -0,0 +1,322 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description:
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#include "RealFTVolume.h"
+
+RealFTVolume::RealFTVolume() : _data(NULL),
+                               _size(0),
+                               _nCol(0),
+                               _nRow(0),
+                               _nSlc(0),
+                               _nColFT(0) {}
+
+RealFTVolume::RealFTVolume(const long nCol,
+                           const long nRow,
+                           const long nSlc) : _data(NULL),
+                                              _size(0)
+{
+    alloc(nCol, nRow, nSlc);
+}
+
+RealFTVolume::~RealFTVolume()
+{
+    clear();
+}
+
+void RealFTVolume::swap(RealFTVolume& that)
+{
+    std::swap(_data, that._data);
+    std::swap(_size, that._size);
+
+    std::swap(_nCol, that._nCol);
+    std::swap(_nRow, that._nRow);
+    std::swap(_nSlc, that._nSlc);
+
+    std::swap(_nColFT, that._nColFT);
+
+    FOR_CELL_DIM_3
+        std::swap(_box[k][j][i], that._box[k][j][i]);
+}
+
+void RealFTVolume::alloc(const long nCol,
+                         const long nRow,
+                         const long nSlc)
+{
+    clear();
+
+    _nCol = nCol;
+    _nRow = nRow;
+    _nSlc = nSlc;
+
+    _size = (nCol / 2 + 1) * nRow * nSlc;
+
+#ifdef FFTW_PTR_THREAD_SAFETY
+    #pragma omp critical (line111)
+#endif
+    _data = (RFLOAT*)TSFFTW_malloc(_size * sizeof(RFLOAT));
+
+    if (_data == NULL)
+    {
+        REPORT_ERROR("FAIL TO ALLOCATE SPACE");
+
+        abort();
+    }
+
+    initBox();
+}
+
+void RealFTVolume::clear()
+{
+    if (_data != NULL)
+    {
+#ifdef FFTW_PTR_THREAD_SAFETY
+        #pragma omp critical (line54)
+#endif
+        TSFFTW_free(_data);
+
+        _data = NULL;
+    }
+
+    _size = 0;
+
+    _nCol = 0;
+    _nRow = 0;
+    _nSlc = 0;
+
+    _nColFT = 0;
+}
+
+void RealFTVolume::addFT(const RFLOAT value,
+                         const long iCol,
+                         const long iRow,
+                         const long iSlc)
+{
+    size_t index = iFT(iCol, iRow, iSlc);
+
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+    if (index >= _size) REPORT_ERROR("OUT OF BOUNDARY FT");
+#endif
+
+    #pragma omp atomic
+    _data[index] += value;
+}
+
+RFLOAT RealFTVolume::getByInterpolationFT(RFLOAT iCol,
+                                          RFLOAT iRow,
+                                          RFLOAT iSlc,
+                                          const int interp) const
+{
+    // the conjugate of a real value is itself
+    if (iCol < 0)
+    {
+        iCol *= -1;
+        iRow *= -1;
+        iSlc *= -1;
+    }
+
+    if (interp == NEAREST_INTERP)
+        return getFTHalf(AROUND(iCol), AROUND(iRow), AROUND(iSlc));
+
+    RFLOAT w[2][2][2];
+    long x0[3];
+    RFLOAT x[3] = {iCol, iRow, iSlc};
+
+    WG_TRI_INTERP_LINEAR(w, x0, x);
+
+    return getFTHalf(w, x0);
+}
+
+void RealFTVolume::addFT(const RFLOAT value,
+                         RFLOAT iCol,
+                         RFLOAT iRow)
+{
+    if (iCol < 0)
+    {
+        iCol *= -1;
+        iRow *= -1;
+    }
+
+    RFLOAT w[2][2];
+    long x0[2];
+    RFLOAT x[2] = {iCol, iRow};
+
+    WG_BI_INTERP_LINEAR(w, x0, x);
+
+    addFTHalf(value, w, x0);
+}
+
+void RealFTVolume::addFT(const RFLOAT value,
+                         RFLOAT iCol,
+                         RFLOAT iRow,
+                         RFLOAT iSlc)
+{
+    if (iCol < 0)
+    {
+        iCol *= -1;
+        iRow *= -1;
+        iSlc *= -1;
+    }
+
+    RFLOAT w[2][2][2];
+    long x0[3];
+    RFLOAT x[3] = {iCol, iRow, iSlc};
+
+    WG_TRI_INTERP_LINEAR(w, x0, x);
+
+    addFTHalf(value, w, x0);
+}
+
+void RealFTVolume::addFT(const RFLOAT value,
+                         const RFLOAT iCol,
+                         const RFLOAT iRow,
+                         const RFLOAT a,
+                         const TabFunction& kernel)
+{
+    RFLOAT a2 = TSGSL_pow_2(a);
+
+    for (long j = GSL_MAX_INT(-_nRow / 2, FLOOR(iRow - a));
+              j <= GSL_MIN_INT(_nRow / 2 - 1, CEIL(iRow + a));
+              j++)
+        for (long i = GSL_MAX_INT(-_nCol / 2, FLOOR(iCol - a));
+                  i <= GSL_MIN_INT(_nCol / 2, CEIL(iCol + a));
+                  i++)
+        {
+            RFLOAT r2 = QUAD(iCol - i, iRow - j);
+            if (r2 < a2) addFT(value * kernel(r2), i, j);
+        }
+}
+
+void RealFTVolume::addFT(const RFLOAT value,
+                         const RFLOAT iCol,
+                         const RFLOAT iRow,
+                         const RFLOAT iSlc,
+                         const RFLOAT a,
+                         const TabFunction& kernel)
+{
+    RFLOAT a2 = TSGSL_pow_2(a);
+
+    for (long k = GSL_MAX_INT(-_nSlc / 2, FLOOR(iSlc - a));
+              k <= GSL_MIN_INT(_nSlc / 2 - 1, CEIL(iSlc + a));
+              k++)
+        for (long j = GSL_MAX_INT(-_nRow / 2, FLOOR(iRow - a));
+                  j <= GSL_MIN_INT(_nRow / 2 - 1, CEIL(iRow + a));
+                  j++)
+            for (long i = GSL_MAX_INT(-_nCol / 2, FLOOR(iCol - a));
+                      i <= GSL_MIN_INT(_nCol / 2, CEIL(iCol + a));
+                      i++)
+            {
+                RFLOAT r2 = QUAD_3(iCol - i, iRow - j, iSlc - k);
+                if (r2 < a2) addFT(value * kernel(r2), i, j, k);
+            }
+}
+
+void RealFTVolume::initBox()
+{
+    _nColFT = _nCol / 2 + 1;
+
+    FOR_CELL_DIM_3
+        _box[k][j][i] = k * _nColFT * _nRow
+                      + j * _nColFT
+                      + i;
+}
+
+RFLOAT RealFTVolume::getFTHalf(const RFLOAT w[2][2][2],
+                               const long x0[3]) const
+{
+    RFLOAT result = 0;
+
+    if ((x0[1] != -1) &&
+        (x0[2] != -1))
+    {
+        size_t index0 = iFTHalf(x0[0], x0[1], x0[2]);
+
+        for (long i = 0; i < 8; i++)
+        {
+            size_t index = index0 + ((size_t*)_box)[i];
+
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+            if (index >= _size) REPORT_ERROR("OUT OF BOUNDARY FT");
+#endif
+
+            result += _data[index] * ((RFLOAT*)w)[i];
+        }
+    }
+    else
+    {
+        FOR_CELL_DIM_3 result += getFTHalf(x0[0] + i,
+                                           x0[1] + j,
+                                           x0[2] + k)
+                               * w[k][j][i];
+    }
+
+    return result;
+}
+
+void RealFTVolume::addFTHalf(const RFLOAT value,
+                             const RFLOAT w[2][2],
+                             const long x0[2])
+{
+    if (x0[1] != -1)
+    {
+        size_t index0 = iFTHalf(x0[0], x0[1]);
+
+        for (long j = 0; j < 2; j++)
+            for (long i = 0; i < 2; i++)
+            {
+                size_t index = index0 + _box[0][j][i];
+
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+                if (index >= _size) REPORT_ERROR("OUT OF BOUNDARY FT");
+#endif
+
+                #pragma omp atomic
+                _data[index] += value * w[j][i];
+            }
+    }
+    else
+    {
+        FOR_CELL_DIM_2
+        {
+            #pragma omp atomic
+            _data[iFTHalf(x0[0] + i, x0[1] + j)] += value * w[j][i];
+        }
+    }
+}
+
+void RealFTVolume::addFTHalf(const RFLOAT value,
+                             const RFLOAT w[2][2][2],
+                             const long x0[3])
+{
+    if ((x0[1] != -1) &&
+        (x0[2] != -1))
+    {
+        size_t index0 = iFTHalf(x0[0], x0[1], x0[2]);
+
+        for (long i = 0; i < 8; i++)
+        {
+            size_t index = index0 + ((size_t*)_box)[i];
+
+#ifndef IMG_VOL_BOUNDARY_NO_CHECK
+            if (index >= _size) REPORT_ERROR("OUT OF BOUNDARY FT");
+#endif
+
+            #pragma omp atomic
+            _data[index] += value * ((RFLOAT*)w)[i];
+        }
+    }
+    else
+    {
+        FOR_CELL_DIM_3
+        {
+            #pragma omp atomic
+            _data[iFTHalf(x0[0] + i, x0[1] + j, x0[2] + k)] += value * w[k][j][i];
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Author: Mingxu Hu
+ * Dependency:
+ * Test:
+ * Execution:
+ * Description:
+ *
+ * Manual:
+ * ****************************************************************************/
+
+#include "StackWriter.h"
+
+/**
+ * writing the image of a slot into the stack, after which the slot is returned
+ */
+struct StackWriter::SlotWriting : public AsyncWriter::Job
+{
+    StackWriter* _writer;
+
+    int _slot;
+
+    int _iSlc;
+
+    SlotWriting(StackWriter* writer,
+                const int slot,
+                const int iSlc) : _writer(writer), _slot(slot), _iSlc(iSlc) {}
+
+    void write()
+    {
+        _writer->_imf->writeStack(_writer->_slot[_slot], _iSlc);
+
+        pthread_mutex_lock(&_writer->_mutex);
+
+        _writer->_free.push_back(_slot);
+
+        pthread_cond_signal(&_writer->_freeCond);
+
+        pthread_mutex_unlock(&_writer->_mutex);
+    }
+};
+
+StackWriter::StackWriter(ImageFile& imf,
+                         const int nSlot,
+                         const int size) : _imf(&imf),
+                                           _nSlot(nSlot)
+{
+    _slot = new Image[nSlot];
+
+    for (int i = 0; i < nSlot; i++)
+    {
+        _slot[i].alloc(size, size, RL_SPACE);
+
+        _free.push_back(i);
+    }
+
+    pthread_mutex_init(&_mutex, NULL);
+    pthread_cond_init(&_freeCond, NULL);
+}
+
+StackWriter::~StackWriter()
+{
+    finish();
+
+    pthread_cond_destroy(&_freeCond);
+    pthread_mutex_destroy(&_mutex);
+
+    delete[] _slot;
+}
+
+int StackWriter::acquire()
+{
+    pthread_mutex_lock(&_mutex);
+
+    while (_free.empty())
+        pthread_cond_wait(&_freeCond, &_mutex);
+
+    int slot = _free.back();
+
+    _free.pop_back();
+
+    pthread_mutex_unlock(&_mutex);
+
+    return slot;
+}
+
+void StackWriter::submit(const int slot,
+                         const int iSlc)
+{
+    _writer.submit(new SlotWriting(this, slot, iSlc));
+}
+
+void StackWriter::finish()
+{
+    _writer.wait();
+}
@@ -128,6 +128,25 @@ void Volume::alloc(const long nCol,
     initBox();
 }
 
+#ifdef FFTW_PTR
+void Volume::attachFT(Complex* data,
+                      const long nCol,
+                      const long nRow,
+                      const long nSlc)
+{
+    ImageBase::attachFT(data);
+
+    _nCol = nCol;
+    _nRow = nRow;
+    _nSlc = nSlc;
+
+    _sizeRL = nCol * nRow * nSlc;
+    _sizeFT = (nCol / 2 + 1) * nRow * nSlc;
+
+    initBox();
+}
+#endif
+
 RFLOAT Volume::getRL(const long iCol,
                      const long iRow,
                      const long iSlc) const
@@ -316,25 +335,10 @@ Complex Volume::getByInterpolationFT(RFLOAT iCol,
                                      RFLOAT iSlc,
                                      const int interp) const
 {
-    bool conj = conjHalf(iCol, iRow, iSlc);
-
     if (interp == NEAREST_INTERP)
-    {
-        Complex result = getFTHalf(AROUND(iCol), AROUND(iRow), AROUND(iSlc));
-
-        return conj ? CONJUGATE(result) : result;
-    }
-
-    RFLOAT w[2][2][2];
-    long x0[3];
-    RFLOAT x[3] = {iCol, iRow, iSlc};
-
-    //WG_TRI_INTERP(w, x0, x, interp);
-    WG_TRI_INTERP_LINEAR(w, x0, x);
-
-    Complex result = getFTHalf(w, x0);
-
-    return conj ? CONJUGATE(result) : result;
+        return getByInterpolationFT<NEAREST_INTERP>(iCol, iRow, iSlc);
+    else
+        return getByInterpolationFT<LINEAR_INTERP>(iCol, iRow, iSlc);
 }
 //huabin
 void Volume::addFT(const Complex value,
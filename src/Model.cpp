@@ -309,6 +309,15 @@ void Model::compareTwoHemispheres(const bool fscFlag,
                                   const RFLOAT thres,
                                   const unsigned int nThread)
 {
+#ifdef MODEL_COMPARE_DISTRIBUTED
+    if (!(fscFlag && (_maskFSC || _coreFSC) && (_mode == MODE_3D)))
+    {
+        compareTwoHemispheresDist(fscFlag, avgFlag, thres, nThread);
+
+        return;
+    }
+#endif
+
     if (fscFlag)
     {
         MLOG(INFO, "LOGGER_COMPARE") << "Setting Size of _FSC";
@@ -850,6 +859,198 @@ void Model::compareTwoHemispheres(const bool fscFlag,
     }
 }
 
+#ifdef MODEL_COMPARE_DISTRIBUTED
+void Model::compareTwoHemispheresDist(const bool fscFlag,
+                                      const bool avgFlag,
+                                      const RFLOAT thres,
+                                      const unsigned int nThread)
+{
+    if (fscFlag)
+    {
+        MLOG(INFO, "LOGGER_COMPARE") << "Setting Size of _FSC";
+
+        _FSC.resize(_rU, _k);
+
+        if ((_mode == MODE_2D) && _coreFSC)
+            MLOG(WARNING, "LOGGER_COMPARE") << "2D MODE DOES NOT SUPPORT CORE REGION FSC";
+
+        if ((_mode == MODE_2D) && _maskFSC)
+            MLOG(WARNING, "LOGGER_COMPARE") << "2D MODE DOES NOT SUPPORT MASK REGION FSC";
+    }
+
+    // process i of hemisphere A (rank 2i + 1) pairs with process i of
+    // hemisphere B (rank 2i + 2), hemisphere A may have one process more
+    int nPair = (_commSize - 1) / 2;
+
+    int hemiRank = -1;
+
+    NT_MASTER MPI_Comm_rank(_hemi, &hemiRank);
+
+    bool paired = (hemiRank >= 0) && (hemiRank < nPair);
+
+    int partner = isA() ? _commRank + 1 : _commRank - 1;
+
+    // the Fourier space is split into slabs of lines along the column
+    long nColFT = _size / 2 + 1;
+    long nRow = _size;
+    long nSlc = (_mode == MODE_2D) ? 1 : _size;
+
+    size_t nLine = nRow * nSlc;
+
+    size_t lineBegin = paired ? nLine * hemiRank / nPair : 0;
+    size_t lineEnd = paired ? nLine * (hemiRank + 1) / nPair : 0;
+
+    size_t nSlab = (lineEnd - lineBegin) * nColFT;
+
+    Complex* slab = paired ? (Complex*)TSFFTW_malloc(nSlab * sizeof(Complex)) : NULL;
+
+    MLOG(INFO, "LOGGER_COMPARE") << "Comparing Hemisphere A and Hemisphere B in "
+                                 << nPair
+                                 << " Pairs of Processes";
+
+    FOR_EACH_CLASS
+    {
+        Complex* own = paired ? &_ref[l][lineBegin * nColFT] : NULL;
+
+        if (paired)
+        {
+#ifndef NAN_NO_CHECK
+            SEGMENT_NAN_CHECK_COMPLEX(own, nSlab);
+#endif
+
+            for (size_t i = 0; i < nSlab; i += MPI_MAX_BUF / 2)
+            {
+                int n = (int)GSL_MIN(nSlab - i, (size_t)MPI_MAX_BUF / 2);
+
+                MPI_Sendrecv(own + i,
+                             2 * n,
+                             TS_MPI_DOUBLE,
+                             partner,
+                             l,
+                             slab + i,
+                             2 * n,
+                             TS_MPI_DOUBLE,
+                             partner,
+                             l,
+                             MPI_COMM_WORLD,
+                             MPI_STATUS_IGNORE);
+            }
+        }
+
+        const Complex* slabA = isA() ? own : slab;
+        const Complex* slabB = isA() ? slab : own;
+
+        if (fscFlag)
+        {
+            MLOG(INFO, "LOGGER_COMPARE") << "Calculating FSC of Reference " << l;
+
+            // per-shell sums of Re(A * B^*), |A|^2, |B|^2 and number of voxels, only
+            // hemisphere A contributes, as both processes of a pair hold the same slabs
+            dvec sum = dvec::Zero(4 * _rU);
+
+            if (paired && isA())
+                shellReduce(sum,
+                            ShellSumFSC(slabA, slabB),
+                            _size,
+                            nRow,
+                            nSlc,
+                            _rU,
+                            nThread,
+                            lineBegin,
+                            lineEnd);
+
+            MPI_Allreduce(MPI_IN_PLACE,
+                          sum.data(),
+                          4 * _rU,
+                          MPI_DOUBLE,
+                          MPI_SUM,
+                          MPI_COMM_WORLD);
+
+            for (int i = 0; i < _rU; i++)
+            {
+                double AB = sqrt(sum(_rU + i) * sum(2 * _rU + i));
+
+                _FSC(i, l) = (AB == 0) ? 0 : sum(i) / AB;
+            }
+        }
+
+        if (avgFlag)
+        {
+            MLOG(INFO, "LOGGER_COMPARE") << "Averaging A and B";
+
+            // below the radius r, A and B are averaged, otherwise they are kept
+            long r = _size;
+
+#ifndef MODEL_AVERAGE_TWO_HEMISPHERE
+            if ((_k == 1) && (_goldenStandard))
+            {
+#ifdef MODEL_RESOLUTION_BASE_AVERAGE
+                r = resolutionP(thres, false);
+#else
+                r = GSL_MIN_INT(AROUND(resA2P(1.0 / A_B_AVERAGE_THRES,
+                                              _size,
+                                              _pixelSize)),
+                                _r);
+#endif
+
+                MLOG(INFO, "LOGGER_COMPARE") << "Averaging A and B Below Resolution "
+                                             << 1.0 / resP2A(r, _size, _pixelSize)
+                                             << "(Angstrom)";
+            }
+#endif
+
+            if (paired)
+            {
+                #pragma omp parallel for schedule(dynamic) num_threads(nThread)
+                for (size_t line = lineBegin; line < lineEnd; line++)
+                {
+                    long j = line % nRow;
+                    long k = line / nRow;
+
+                    j = (2 * j < nRow) ? j : j - nRow;
+                    k = (2 * k < nSlc) ? k : k - nSlc;
+
+                    size_t offset = (line - lineBegin) * nColFT;
+
+                    for (long i = 0; i < nColFT; i++)
+                    {
+                        if (QUAD_3(i, j, k) < r * r)
+                            own[offset + i] = (slabA[offset + i] + slabB[offset + i]) / 2;
+#ifdef MODEL_SWAP_HEMISPHERE
+                        else
+                            own[offset + i] = slab[offset + i];
+#endif
+                    }
+                }
+            }
+
+            NT_MASTER
+            {
+                for (int p = 0; p < nPair; p++)
+                {
+                    size_t begin = nLine * p / nPair;
+                    size_t end = nLine * (p + 1) / nPair;
+
+                    MPI_Bcast_Large(&_ref[l][begin * nColFT],
+                                    2 * (end - begin) * nColFT,
+                                    TS_MPI_DOUBLE,
+                                    p,
+                                    _hemi);
+                }
+            }
+
+#ifdef VERBOSE_LEVEL_1
+            MLOG(INFO, "LOGGER_COMPARE") << "Reference " << l << " Averaged and Broadcasted in Hemisphere A and B";
+#endif
+        }
+    }
+
+    if (slab != NULL) TSFFTW_free(slab);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+#endif
+
 void Model::lowPassRef(const RFLOAT thres,
                        const RFLOAT ew,
                        const unsigned int nThread)
@@ -1012,6 +1213,15 @@ void Model::setProjMaxRadius(const int maxRadius)
 
 void Model::refreshProj(const unsigned int nThread)
 {
+#ifdef MODEL_SHARE_PROJECTOR
+    if (_mode == MODE_3D)
+    {
+        refreshProjShared(nThread);
+
+        return;
+    }
+#endif
+
     FOR_EACH_CLASS
     {
         _proj[l].setPf(_pf);
@@ -1043,6 +1253,74 @@ void Model::refreshProj(const unsigned int nThread)
     }
 }
 
+#ifdef MODEL_SHARE_PROJECTOR
+void Model::refreshProjShared(const unsigned int nThread)
+{
+    if (_node == MPI_COMM_NULL)
+        MPI_Comm_split_type(_hemi, MPI_COMM_TYPE_SHARED, _commRank, MPI_INFO_NULL, &_node);
+
+    int nodeRank;
+    MPI_Comm_rank(_node, &nodeRank);
+
+    long size = _pf * _size;
+    size_t sizeFT = (size / 2 + 1) * size * size;
+
+    FOR_EACH_CLASS
+    {
+        _proj[l].setPf(_pf);
+
+        if (_searchType == SEARCH_TYPE_GLOBAL)
+            _proj[l].setInterp(INTERP_TYPE_GLOBAL);
+        else
+            _proj[l].setInterp(INTERP_TYPE_LOCAL);
+
+        _proj[l].setMode(MODE_3D);
+
+        // detach from the window of the last refreshing before freeing it
+        _proj[l].clearProjectee();
+    }
+
+    if (_projWin != MPI_WIN_NULL)
+        MPI_Win_free(&_projWin);
+
+    // only the first process of the node allocates, the others map its segment
+    MPI_Aint nByte = (nodeRank == 0) ? (MPI_Aint)(_k * sizeFT * sizeof(Complex)) : 0;
+
+    Complex* data;
+
+    MPI_Win_allocate_shared(nByte, sizeof(Complex), MPI_INFO_NULL, _node, &data, &_projWin);
+
+    MPI_Aint segSize;
+    int dispUnit;
+
+    MPI_Win_shared_query(_projWin, 0, &segSize, &dispUnit, &data);
+
+    MPI_Win_fence(0, _projWin);
+
+    if (nodeRank == 0)
+    {
+        FOR_EACH_CLASS
+        {
+            _proj[l].setProjectee(_ref[l].copyVolume(), nThread);
+
+            memcpy(data + l * sizeFT, _proj[l].projectee3D().dataFT(), sizeFT * sizeof(Complex));
+
+            // release the private copy right away, keeping the peak memory usage low
+            _proj[l].clearProjectee();
+        }
+    }
+
+    MPI_Win_fence(0, _projWin);
+
+    FOR_EACH_CLASS
+    {
+        _proj[l].attachProjectee(data + l * sizeFT, size);
+
+        _proj[l].setMaxRadius(_r);
+    }
+}
+#endif
+
 void Model::refreshReco()
 {
     ALOG(INFO, "LOGGER_SYS") << "Refreshing Reconstructor(s) with Frequency Upper Boundary : "
@@ -1573,6 +1851,14 @@ void Model::clear()
 
     _proj.clear();
     _reco.clear();
+
+#ifdef MODEL_SHARE_PROJECTOR
+    if (_projWin != MPI_WIN_NULL)
+        MPI_Win_free(&_projWin);
+
+    if (_node != MPI_COMM_NULL)
+        MPI_Comm_free(&_node);
+#endif
 }
 
 #ifdef MODEL_DETERMINE_INCREASE_R_R_CHANGE
@@ -9,6 +9,8 @@
 
 #include "Optimiser.h"
 
+#include <map>
+
 #ifdef ENABLE_SIMD_512
  RFLOAT* logDataVSPrior_m_n_huabin_SIMD512(Complex* dat, const Complex* pri, const RFLOAT* ctf, const RFLOAT* sigRcp, const int n, const int m, RFLOAT *SIMDResult);
  RFLOAT logDataVSPrior_m_huabin_SIMD512(Complex* dat, const Complex* pri, const RFLOAT* ctf, const RFLOAT* sigRcp, const int m);
@@ -22,6 +24,18 @@
 #endif
 #endif
 
+static bool ctfAttrLess(const CTFAttr& a,
+                        const CTFAttr& b)
+{
+    if (a.voltage != b.voltage) return a.voltage < b.voltage;
+    if (a.defocusU != b.defocusU) return a.defocusU < b.defocusU;
+    if (a.defocusV != b.defocusV) return a.defocusV < b.defocusV;
+    if (a.defocusTheta != b.defocusTheta) return a.defocusTheta < b.defocusTheta;
+    if (a.Cs != b.Cs) return a.Cs < b.Cs;
+    if (a.amplitudeContrast != b.amplitudeContrast) return a.amplitudeContrast < b.amplitudeContrast;
+    return a.phaseShift < b.phaseShift;
+}
+
 void compareDVPVariable(vec& dvpHuabin, vec& dvpOrig, int processRank, int threadID, int n ,int m)
 {
     fprintf(stderr, "n = %d, m = %d\n", n, m);
@@ -113,6 +127,11 @@ Optimiser::~Optimiser()
 
     _fftImg.fwDestroyPlan();
     _fftImg.bwDestroyPlan();
+
+    _fftRef.fwDestroyPlan();
+    _fftRef.bwDestroyPlan();
+
+    waitSavingBMP();
 }
 
 OptimiserPara& Optimiser::para()
@@ -157,6 +176,30 @@ void Optimiser::init()
     MLOG(INFO, "LOGGER_INIT") << "Symmetry Order : " << _sym.pgOrder();
     MLOG(INFO, "LOGGER_INIT") << "Number of Symmetry Element : " << 1 + _sym.nSymmetryElement();
 
+    if (_para.symInsert)
+    {
+#ifdef GPU_VERSION
+        MLOG(WARNING, "LOGGER_INIT") << "Symmetry Expanded Insertion Not Supported in GPU Version, Symmetrizing After Insertion";
+
+        _para.symInsert = false;
+#else
+        MLOG(INFO, "LOGGER_INIT") << "Inserting Images Under All Symmetry Related Rotations";
+#endif
+    }
+
+#ifdef GPU_VERSION
+    if (_para.mkbInsert != (RECONSTRUCTOR_KERNEL_DEFAULT == RECONSTRUCTOR_KERNEL_MKB))
+    {
+        MLOG(WARNING, "LOGGER_INIT") << "Insertion Kernel of GPU Version Fixed at Compilation, Ignoring "
+                                     << KEY_MKB_INSERT;
+
+        _para.mkbInsert = (RECONSTRUCTOR_KERNEL_DEFAULT == RECONSTRUCTOR_KERNEL_MKB);
+    }
+#endif
+
+    MLOG(INFO, "LOGGER_INIT") << "Insertion Kernel : "
+                              << (_para.mkbInsert ? "Modified Kaiser Bessel" : "Trilinear");
+
     MLOG(INFO, "LOGGER_INIT") << "Number of Class(es): " << _para.k;
 
     MLOG(INFO, "LOGGER_INIT") << "Initialising FFTW Plan";
@@ -164,6 +207,20 @@ void Optimiser::init()
     _fftImg.fwCreatePlan(_para.size, _para.size, _para.nThreadsPerProcess);
     _fftImg.bwCreatePlan(_para.size, _para.size, _para.nThreadsPerProcess);
 
+    NT_MASTER
+    {
+        if (_para.mode == MODE_2D)
+        {
+            _fftRef.fwCreatePlan(_para.size, _para.size, _para.nThreadsPerProcess);
+            _fftRef.bwCreatePlan(_para.size, _para.size, _para.nThreadsPerProcess);
+        }
+        else
+        {
+            _fftRef.fwCreatePlan(_para.size, _para.size, _para.size, _para.nThreadsPerProcess);
+            _fftRef.bwCreatePlan(_para.size, _para.size, _para.size, _para.nThreadsPerProcess);
+        }
+    }
+
     MLOG(INFO, "LOGGER_INIT") << "Initialising Class Distribution";
     _cDistr.resize(_para.k);
 
@@ -319,6 +376,18 @@ void Optimiser::init()
     //_model.setRPrev(_r);
     //_model.setRT(_r);
 
+    if (_para.randomSeed != 0)
+    {
+        MLOG(INFO, "LOGGER_INIT") << "Seeding Random Engines with " << _para.randomSeed;
+
+        set_random_seed(_para.randomSeed);
+    }
+
+    if (_para.masterShareNode)
+    {
+        MLOG(INFO, "LOGGER_INIT") << "Master Process Sharing Node with Workers, Waiting without Occupying a Core";
+    }
+
     MLOG(INFO, "LOGGER_INIT") << "Setting MPI Environment of _exp";
     _db.setMPIEnv(_commSize, _commRank, _hemi, _slav);
 
@@ -362,7 +431,7 @@ void Optimiser::init()
         initMask();
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_INIT") << "Mask Read";
 #endif
@@ -502,7 +571,7 @@ void Optimiser::init()
     bcastGroupInfo();
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_INIT") << "Information of Groups Broadcasted";
 #endif
@@ -523,7 +592,7 @@ void Optimiser::init()
     }
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_INIT") << "Projectors and Reconstructors Set Up";
 #endif
@@ -554,7 +623,7 @@ void Optimiser::init()
         }
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_INIT") << "Intensity Scale Re-balanced";
 #endif
@@ -584,7 +653,7 @@ void Optimiser::init()
     }
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_INIT") << "Sigma Initialised";
 #endif
@@ -753,6 +822,9 @@ void Optimiser::expectation()
         Complex* poolPriRotP = (Complex*)TSFFTW_malloc(_nPxl * omp_get_max_threads() * sizeof(Complex));
         Complex* poolPriAllP = (Complex*)TSFFTW_malloc(_nPxl * omp_get_max_threads() * sizeof(Complex));
 
+        RFLOAT* poolLogW = (RFLOAT*)TSFFTW_malloc(_ID.size() * N_WEIGHT_BLOCK_GLOBAL * omp_get_max_threads() * sizeof(RFLOAT));
+        RFLOAT* poolBlockW = (RFLOAT*)TSFFTW_malloc(N_WEIGHT_BLOCK_GLOBAL * omp_get_max_threads() * sizeof(RFLOAT));
+
         for (size_t t = 0; t < (size_t)_para.k; t++)
         {
             #pragma omp parallel for schedule(dynamic) private(rot2D, rot3D)
@@ -766,6 +838,9 @@ void Optimiser::expectation()
                 //Add by huabin
                 RFLOAT* SIMDResult = poolSIMDResult + omp_get_thread_num() * _ID.size();
 
+                RFLOAT* logW = poolLogW + omp_get_thread_num() * _ID.size() * N_WEIGHT_BLOCK_GLOBAL;
+                RFLOAT* blockW = poolBlockW + omp_get_thread_num() * N_WEIGHT_BLOCK_GLOBAL;
+
                 // perform projection
 
                 if (_para.mode == MODE_2D)
@@ -787,108 +862,97 @@ void Optimiser::expectation()
                     abort();
                 }
 
-                for (size_t n = 0; n < (size_t)nT; n++)
+                for (size_t n0 = 0; n0 < (size_t)nT; n0 += N_WEIGHT_BLOCK_GLOBAL)
                 {
-                    for (int i = 0; i < _nPxl; i++)
-                        priAllP[i] = traP[_nPxl * n + i] * priRotP[i];
+                    int nb = MIN(N_WEIGHT_BLOCK_GLOBAL, (int)(nT - n0));
+
+                    for (int j = 0; j < nb; j++)
+                    {
+                        size_t n = n0 + j;
+
+                        for (int i = 0; i < _nPxl; i++)
+                            priAllP[i] = traP[_nPxl * n + i] * priRotP[i];
 
-                    // higher logDataVSPrior, higher probability
+                        // higher logDataVSPrior, higher probability
 
-                    //Add by huabin
-                    memset(SIMDResult, '\0', _ID.size() * sizeof(RFLOAT));
+                        //Add by huabin
+                        memset(SIMDResult, '\0', _ID.size() * sizeof(RFLOAT));
 
 #ifdef ENABLE_SIMD_512
-            RFLOAT* dvp = logDataVSPrior_m_n_huabin_SIMD512(_datP,
-                                             priAllP,
-                                             _ctfP,
-                                             _sigRcpP,
-                                             (int)_ID.size(),
-                                             _nPxl,
-                                             SIMDResult);
+                RFLOAT* dvp = logDataVSPrior_m_n_huabin_SIMD512(_datP,
+                                                 priAllP,
+                                                 _ctfP,
+                                                 _sigRcpP,
+                                                 (int)_ID.size(),
+                                                 _nPxl,
+                                                 SIMDResult);
 #else
 #ifdef ENABLE_SIMD_256
-            RFLOAT* dvp = logDataVSPrior_m_n_huabin_SIMD256(_datP,
-                                             priAllP,
-                                             _ctfP,
-                                             _sigRcpP,
-                                             (int)_ID.size(),
-                                             _nPxl,
-                                             SIMDResult);
+                RFLOAT* dvp = logDataVSPrior_m_n_huabin_SIMD256(_datP,
+                                                 priAllP,
+                                                 _ctfP,
+                                                 _sigRcpP,
+                                                 (int)_ID.size(),
+                                                 _nPxl,
+                                                 SIMDResult);
 #else
-            RFLOAT* dvp = logDataVSPrior_m_n_huabin(_datP,
-                                             priAllP,
-                                             _ctfP,
-                                             _sigRcpP,
-                                             (int)_ID.size(),
-                                             _nPxl,
-                                             SIMDResult);
+                RFLOAT* dvp = logDataVSPrior_m_n_huabin(_datP,
+                                                 priAllP,
+                                                 _ctfP,
+                                                 _sigRcpP,
+                                                 (int)_ID.size(),
+                                                 _nPxl,
+                                                 SIMDResult);
 #endif
 #endif
 
 #ifndef NAN_NO_CHECK
 
-           SEGMENT_NAN_CHECK(dvp, _ID.size());
+               SEGMENT_NAN_CHECK(dvp, _ID.size());
 
 #endif
 
+                        FOR_EACH_2D_IMAGE
+                            logW[l * N_WEIGHT_BLOCK_GLOBAL + j] = dvp[l];
+                    }
+
+                    // merge the block of translations into the weights of
+                    // each image, taking its lock once per block
+
                     FOR_EACH_2D_IMAGE
                     {
-                        omp_set_lock(&mtx[l]);
+                        RFLOAT blockMax = blockWeight(blockW,
+                                                      logW + l * N_WEIGHT_BLOCK_GLOBAL,
+                                                      nb);
 
-                        if (TSGSL_isnan(baseLine[l]))
-                            baseLine[l] = dvp[l];
-                        else
-                        {
-                            if (dvp[l] > baseLine[l])
-                            {
-                                RFLOAT offset = dvp[l] - baseLine[l];
+                        RFLOAT sumWT = 0;
 
-                                RFLOAT nf = exp(-offset);
+                        for (int j = 0; j < nb; j++)
+                            sumWT += blockW[j] * _par[l].wT(n0 + j);
 
-                                wC.row(l) *= nf;
+                        omp_set_lock(&mtx[l]);
 
-                                for (int td = 0; td < _para.k; td++)
-                                {
-                                    wR[td].row(l) *= nf;
-                                    wT[td].row(l) *= nf;
-                                }
+                        RFLOAT scale;
 
-                                /***
-                                RFLOAT nf = exp(offset);
+                        RFLOAT nf = mergeBaseLine(baseLine[l], scale, blockMax);
 
-                                if (TSGSL_isinf(nf))
-                                {
-                                    wC.row(l) = vec::Zero(_para.k).transpose();
-                                    wR.row(l) = vec::Zero(nR).transpose();
-                                    wT.row(l) = vec::Zero(nT).transpose();
-                                }
-                                else
-                                {
-                                    wC.row(l) /= nf;
-                                    wR.row(l) /= nf;
-                                    wT.row(l) /= nf;
-                                }
-                                ***/
+                        if (nf != 1)
+                        {
+                            wC.row(l) *= nf;
 
-                                baseLine[l] += offset;
+                            for (int td = 0; td < _para.k; td++)
+                            {
+                                wR[td].row(l) *= nf;
+                                wT[td].row(l) *= nf;
                             }
                         }
 
-                        RFLOAT w = exp(dvp[l] - baseLine[l]);
-
-                        /***
-                        wC(l, t) += w;
-
-                        wR(l, m) += w;
+                        wC(l, t) += scale * sumWT * _par[l].wR(m);
 
-                        wT(l, n) += w;
-                        ***/
+                        wR[t](l, m) += scale * sumWT;
 
-                        wC(l, t) += w * (_par[l].wR(m) * _par[l].wT(n));
-
-                        wR[t](l, m) += w * _par[l].wT(n);
-
-                        wT[t](l, n) += w * _par[l].wR(m);
+                        for (int j = 0; j < nb; j++)
+                            wT[t](l, n0 + j) += scale * blockW[j] * _par[l].wR(m);
 
                         omp_unset_lock(&mtx[l]);
                     }
@@ -916,6 +980,8 @@ void Optimiser::expectation()
         TSFFTW_free(poolSIMDResult);
         TSFFTW_free(poolPriRotP);
         TSFFTW_free(poolPriAllP);
+        TSFFTW_free(poolLogW);
+        TSFFTW_free(poolBlockW);
 
         delete[] mtx;
         delete[] baseLine;
@@ -925,6 +991,8 @@ void Optimiser::expectation()
         #pragma omp parallel for
         FOR_EACH_2D_IMAGE
         {
+            seed_random_engine(_iter, _ID[l], 0);
+
             for (int iC = 0; iC < _para.k; iC++)
                 _par[l].setUC(wC(l, iC), iC);
 
@@ -1149,23 +1217,87 @@ void Optimiser::expectation()
 
     nPer = 0;
 
+    if (_topRChange.size() != _ID.size())
+    {
+        _topRChange.assign(_ID.size(), DBL_MAX);
+        _topTChange.assign(_ID.size(), DBL_MAX);
+        _nFrozen.assign(_ID.size(), 0);
+    }
+
+    _nSkip = 0;
+
+    bool freeze = (_para.freezeConverged) &&
+                  (_searchType == SEARCH_TYPE_LOCAL) &&
+                  (_r <= _rLastE);
+
+    if (_costE.size() != _ID.size())
+        _costE.assign(_ID.size(), 0);
+
+    // images with the most costly particle filters in the last expectation are
+    // dispatched first, so that the threads of this process do not wait for a
+    // long tail at the end; it does not balance the processes against each
+    // other, whose wait at the barrier after the particle filter is logged
+    // instead, frozen images count as costless
+    vector<size_t> orderE(_ID.size());
+
+    if (!_ID.empty())
+        gsl_sort_index(&orderE[0], &_costE[0], 1, _ID.size());
+
+    double timeE = MPI_Wtime();
+
     Complex* poolPriRotP = (Complex*)TSFFTW_malloc(_nPxl * omp_get_max_threads() * sizeof(Complex));
     Complex* poolPriAllP = (Complex*)TSFFTW_malloc(_nPxl * omp_get_max_threads() * sizeof(Complex));
 
     Complex* poolTraP = (Complex*)TSFFTW_malloc(_para.mLT * _nPxl * omp_get_max_threads() * sizeof(Complex));
 
+    RFLOAT* poolLogW = (RFLOAT*)TSFFTW_malloc(_para.mLT * _para.mLD * omp_get_max_threads() * sizeof(RFLOAT));
+    RFLOAT* poolBlockW = (RFLOAT*)TSFFTW_malloc(_para.mLT * _para.mLD * omp_get_max_threads() * sizeof(RFLOAT));
+
     RFLOAT* poolCtfP;
 
     if (_searchType == SEARCH_TYPE_CTF)
         poolCtfP = (RFLOAT*)TSFFTW_malloc(_para.mLD * _nPxl * omp_get_max_threads() * sizeof(RFLOAT));
 
     #pragma omp parallel for schedule(dynamic)
-    FOR_EACH_2D_IMAGE
+    for (ptrdiff_t iOrder = static_cast<ptrdiff_t>(_ID.size()) - 1; iOrder >= 0; iOrder--)
     {
+        ptrdiff_t l = orderE[iOrder];
+
+        double startE = omp_get_wtime();
 
         Complex* priRotP = poolPriRotP + _nPxl * omp_get_thread_num();
         Complex* priAllP = poolPriAllP + _nPxl * omp_get_thread_num();
 
+        RFLOAT* logW = poolLogW + _para.mLT * _para.mLD * omp_get_thread_num();
+        RFLOAT* blockW = poolBlockW + _para.mLT * _para.mLD * omp_get_thread_num();
+
+        if ((freeze) &&
+            (_nFrozen[l] < FREEZE_MAX_N_ITER) &&
+            (_topRChange[l] < FREEZE_THRES_ROT_CHANGE) &&
+            (_topTChange[l] < FREEZE_THRES_TRANS_CHANGE))
+        {
+            // the posterior of the last iteration is kept and re-inserted
+            _nFrozen[l] += 1;
+
+            #pragma omp atomic
+            _nSkip += 1;
+
+            #pragma omp atomic
+            _nI += 1;
+
+            _costE[l] = 0;
+
+            continue;
+        }
+
+        _nFrozen[l] = 0;
+
+        dvec4 topRPrev;
+        dvec2 topTPrev;
+
+        _par[l].rank1st(topRPrev);
+        _par[l].rank1st(topTPrev);
+
         int nPhaseWithNoVariDecrease = 0;
 
 #ifdef OPTIMISER_COMPRESS_CRITERIA
@@ -1182,6 +1314,8 @@ void Optimiser::expectation()
 #endif
         for (int phase = (_searchType == SEARCH_TYPE_GLOBAL) ? 1 : 0; phase < MAX_N_PHASE_PER_ITER; phase++)
         {
+            seed_random_engine(_iter, _ID[l], phase);
+
 #ifdef OPTIMISER_GLOBAL_PERTURB_LARGE
             if (phase == (_searchType == SEARCH_TYPE_GLOBAL) ? 1 : 0)
 #else
@@ -1249,27 +1383,26 @@ void Optimiser::expectation()
                 {
                     ctfP = poolCtfP + _par[l].nD() * _nPxl * omp_get_thread_num();
 
+                    vector<RFLOAT> dk(_par[l].nD());
+
                     FOR_EACH_D(_par[l])
                     {
                         _par[l].d(d, iD);
 
-                        for (int i = 0; i < _nPxl; i++)
-                        {
-                            RFLOAT ki = _K1[l]
-                                      * _defocusP[l * _nPxl + i]
-                                      * d
-                                      * TSGSL_pow_2(_frequency[i])
-                                      + _K2[l]
-                                      * TSGSL_pow_4(_frequency[i])
-                                      - _ctfAttr[l].phaseShift;
-
-                            //ctfP[_nPxl * iD + i] = -w1 * TS_SIN(ki) + w2 * TS_COS(ki);
-                            ctfP[_nPxl * iD + i] = -TS_SQRT(1 - TSGSL_pow_2(_ctfAttr[l].amplitudeContrast))
-                                                 * TS_SIN(ki)
-                                                 + _ctfAttr[l].amplitudeContrast
-                                                 * TS_COS(ki);
-                        }
+                        dk[iD] = d;
                     }
+
+                    CTF(ctfP,
+                        _ctfGeom,
+                        &dk[0],
+                        _par[l].nD(),
+                        _ctfAttr[l].voltage,
+                        _ctfAttr[l].defocusU,
+                        _ctfAttr[l].defocusV,
+                        _ctfAttr[l].defocusTheta,
+                        _ctfAttr[l].Cs,
+                        _ctfAttr[l].amplitudeContrast,
+                        _ctfAttr[l].phaseShift);
                 }
 
                 FOR_EACH_R(_par[l])
@@ -1330,7 +1463,7 @@ void Optimiser::expectation()
                             {
                                 w = logDataVSPrior_m_huabin_SIMD512(_datP + l * _nPxl,
                                                    priAllP,
-                                                   _ctfP + l * _nPxl,
+                                                   _ctfP + _iCtfP[l] * _nPxl,
                                                    _sigRcpP + l * _nPxl,
                                                    _nPxl);
                             }
@@ -1348,7 +1481,7 @@ void Optimiser::expectation()
                             {
                                 w = logDataVSPrior_m_huabin_SIMD256(_datP + l * _nPxl,
                                                    priAllP,
-                                                   _ctfP + l * _nPxl,
+                                                   _ctfP + _iCtfP[l] * _nPxl,
                                                    _sigRcpP + l * _nPxl,
                                                    _nPxl);
                             }
@@ -1365,7 +1498,7 @@ void Optimiser::expectation()
                             {
                                 w = logDataVSPrior_m_huabin(_datP + l * _nPxl,
                                                    priAllP,
-                                                   _ctfP + l * _nPxl,
+                                                   _ctfP + _iCtfP[l] * _nPxl,
                                                    _sigRcpP + l * _nPxl,
                                                    _nPxl);
                             }
@@ -1380,28 +1513,44 @@ void Optimiser::expectation()
 #endif
 #endif
 
-                            baseLine = TSGSL_isnan(baseLine) ? w : baseLine;
+                            logW[iT * _par[l].nD() + iD] = w;
+                        }
+                    }
+
+                    // merge all translations and defoci of this rotation as
+                    // one block
 
-                            if (w > baseLine)
-                            {
-                                RFLOAT nf = exp(baseLine - w);
+                    RFLOAT blockMax = blockWeight(blockW,
+                                                  logW,
+                                                  _par[l].nT() * _par[l].nD());
 
-                                wC *= nf;
-                                wR *= nf;
-                                wT *= nf;
-                                wD *= nf;
+                    RFLOAT scale;
 
-                                baseLine = w;
-                            }
+                    RFLOAT nf = mergeBaseLine(baseLine, scale, blockMax);
+
+                    if (nf != 1)
+                    {
+                        wC *= nf;
+                        wR *= nf;
+                        wT *= nf;
+                        wD *= nf;
+                    }
+
+                    RFLOAT sumW = 0;
+
+                    FOR_EACH_T(_par[l])
+                        FOR_EACH_D(_par[l])
+                        {
+                            RFLOAT s = scale * blockW[iT * _par[l].nD() + iD];
 
-                            RFLOAT s = exp(w - baseLine);
+                            sumW += s * (_par[l].wT(iT) * _par[l].wD(iD));
 
-                            wC(iC) += s * (_par[l].wR(iR) * _par[l].wT(iT) * _par[l].wD(iD));
-                            wR(iR) += s * (_par[l].wC(iC) * _par[l].wT(iT) * _par[l].wD(iD));
                             wT(iT) += s * (_par[l].wC(iC) * _par[l].wR(iR) * _par[l].wD(iD));
                             wD(iD) += s * (_par[l].wC(iC) * _par[l].wR(iR) * _par[l].wT(iT));
                         }
-                    }
+
+                    wC(iC) += sumW * _par[l].wR(iR);
+                    wR(iR) += sumW * _par[l].wC(iC);
                 }
             }
 
@@ -1615,6 +1764,17 @@ void Optimiser::expectation()
             }
         }
 
+        dvec4 topR;
+        dvec2 topT;
+
+        _par[l].rank1st(topR);
+        _par[l].rank1st(topT);
+
+        _topRChange[l] = 1 - fabs(topRPrev.dot(topR));
+        _topTChange[l] = (topTPrev - topT).norm();
+
+        _costE[l] = omp_get_wtime() - startE;
+
         #pragma omp critical  (line1495)
         if (_nI > (int)(_ID.size() / 10))
         {
@@ -1664,9 +1824,68 @@ void Optimiser::expectation()
 
     TSFFTW_free(poolTraP);
 
+    TSFFTW_free(poolLogW);
+    TSFFTW_free(poolBlockW);
+
     if (_searchType == SEARCH_TYPE_CTF)
         TSFFTW_free(poolCtfP);
 
+    timeE = MPI_Wtime() - timeE;
+
+#ifdef VERBOSE_LEVEL_1
+    ILOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Particle Filter Performed in " << timeE << " Seconds";
+#endif
+
+    // the time this process waits for the slowest process of its hemisphere
+    double barrierE = MPI_Wtime();
+
+    MPI_Barrier(_hemi);
+
+    barrierE = MPI_Wtime() - barrierE;
+
+    double timeEMax[2] = {timeE, barrierE};
+    double timeEMean[2] = {timeE, barrierE};
+
+    MPI_Allreduce(MPI_IN_PLACE, timeEMax, 2, MPI_DOUBLE, MPI_MAX, _hemi);
+    MPI_Allreduce(MPI_IN_PLACE, timeEMean, 2, MPI_DOUBLE, MPI_SUM, _hemi);
+
+    int hemiSize;
+    MPI_Comm_size(_hemi, &hemiSize);
+
+    timeEMean[0] /= hemiSize;
+    timeEMean[1] /= hemiSize;
+
+    // the fraction of process time spent waiting at the barrier
+    double waitE = (timeEMean[0] + timeEMean[1] > 0) ? timeEMean[1] / (timeEMean[0] + timeEMean[1]) : 0;
+
+    ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Particle Filter Taking "
+                               << timeEMean[0] << " Seconds in Average and "
+                               << timeEMax[0] << " Seconds at Most";
+    BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Particle Filter Taking "
+                               << timeEMean[0] << " Seconds in Average and "
+                               << timeEMax[0] << " Seconds at Most";
+
+    ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Waiting at the Barrier after Particle Filter for "
+                               << timeEMean[1] << " Seconds in Average and "
+                               << timeEMax[1] << " Seconds at Most, "
+                               << waitE * 100 << "\% of Process Time";
+    BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Waiting at the Barrier after Particle Filter for "
+                               << timeEMean[1] << " Seconds in Average and "
+                               << timeEMax[1] << " Seconds at Most, "
+                               << waitE * 100 << "\% of Process Time";
+
+    if (freeze)
+    {
+        int nSkip = _nSkip;
+
+        MPI_Allreduce(MPI_IN_PLACE, &nSkip, 1, MPI_INT, MPI_SUM, _hemi);
+
+        ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << nSkip << " Converged Images Frozen in Expectation";
+        BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << nSkip << " Converged Images Frozen in Expectation";
+    }
+
+    _rLastE = _r;
+
     ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Freeing Space for Pre-calculation in Expectation";
     BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Freeing Space for Pre-calculation in Expectation";
 
@@ -1930,6 +2149,8 @@ void Optimiser::expectationG()
         #pragma omp parallel for
         FOR_EACH_2D_IMAGE
         {
+            seed_random_engine(_iter, _ID[l], 0);
+
             for (int iC = 0; iC < _para.k; iC++)
                 _par[l].setUC(weightC[l * _para.k + iC], iC);
 
@@ -2421,6 +2642,8 @@ void Optimiser::expectationG()
 #endif
                 for (int phase = (_searchType == SEARCH_TYPE_GLOBAL) ? 1 : 0; phase < MAX_N_PHASE_PER_ITER; phase++)
                 {
+                    seed_random_engine(_iter, _ID[vecImg[itr][l]], phase);
+
 #ifdef OPTIMISER_GLOBAL_PERTURB_LARGE
                     if (phase == (_searchType == SEARCH_TYPE_GLOBAL) ? 1 : 0)
 #else
@@ -2875,6 +3098,8 @@ void Optimiser::expectationG()
 #endif
             for (int phase = (_searchType == SEARCH_TYPE_GLOBAL) ? 1 : 0; phase < MAX_N_PHASE_PER_ITER; phase++)
             {
+                seed_random_engine(_iter, _ID[l], phase);
+
 #ifdef OPTIMISER_GLOBAL_PERTURB_LARGE
                 if (phase == (_searchType == SEARCH_TYPE_GLOBAL) ? 1 : 0)
 #else
@@ -3404,6 +3629,20 @@ void Optimiser::expectationG()
 
 void Optimiser::maximization()
 {
+#ifdef OPTIMISER_NORM_SIGMA_ONE_PASS
+    MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Normalisation Noise and Generating Sigma for the Next Iteration";
+
+    normSigmaOnePass((_iter != 0) && (_searchType != SEARCH_TYPE_GLOBAL),
+                     _para.groupSig);
+
+#ifdef VERBOSE_LEVEL_1
+    waitAll();
+
+    MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Sigma Generated for the Next Iteration";
+#endif
+
+#else
+
 #ifdef OPTIMISER_NORM_CORRECTION
     if ((_iter != 0) && (_searchType != SEARCH_TYPE_GLOBAL))
     {
@@ -3419,13 +3658,15 @@ void Optimiser::maximization()
     allReduceSigma(_para.groupSig);
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Sigma Generated for the Next Iteration";
 #endif
 
 #endif
 
+#endif // OPTIMISER_NORM_SIGMA_ONE_PASS
+
 #ifdef OPTIMISER_CORRECT_SCALE
     if ((_searchType == SEARCH_TYPE_GLOBAL) &&
         (_para.groupScl) &&
@@ -3436,7 +3677,7 @@ void Optimiser::maximization()
         correctScale(false, true);
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Intensity Scale Re-balanced for Each Group";
 #endif
@@ -3464,7 +3705,7 @@ void Optimiser::maximization()
             }
 
 #ifdef VERBOSE_LEVEL_1
-            MPI_Barrier(MPI_COMM_WORLD);
+            waitAll();
 
             MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Image Stacks Freed";
 #endif
@@ -3484,11 +3725,11 @@ void Optimiser::maximization()
         NT_MASTER
         {
             for (int t = 0; t < _para.k; t++)
-                _model.reco(t).allocSpace(_para.nThreadsPerProcess);
+                _model.reco(t).allocSpace(nThreadReco());
         }
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Space Allocated in Reconstructor(s)";
 #endif
@@ -3498,7 +3739,7 @@ void Optimiser::maximization()
         reconstructRef(true, true, true, false, false);
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reference(s) Reconstructed";
 #endif
@@ -3512,7 +3753,7 @@ void Optimiser::maximization()
         }
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Space Freed in Reconstructor(s)";
 #endif
@@ -3537,7 +3778,7 @@ void Optimiser::maximization()
             }
 
 #ifdef VERBOSE_LEVEL_1
-            MPI_Barrier(MPI_COMM_WORLD);
+            waitAll();
 
             MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Image Stacks Allocated";
 #endif
@@ -3558,6 +3799,33 @@ void Optimiser::maximization()
     }
 }
 
+void Optimiser::waitAll()
+{
+    if (_para.masterShareNode)
+        MPI_Barrier_Lazy(MPI_COMM_WORLD);
+    else
+        MPI_Barrier(MPI_COMM_WORLD);
+}
+
+int Optimiser::nThreadReco() const
+{
+    return GSL_MAX_INT(_para.nThreadsPerProcess / nConcReco(), 1);
+}
+
+int Optimiser::nConcReco() const
+{
+    long n = (long)_para.pf * _para.size;
+
+    long nVoxel = (_para.mode == MODE_2D) ? n * n : n * n * n;
+
+    // the fewest threads a class is worth, by the size of its padded reference
+    int nThread = (int)((nVoxel + RECONSTRUCT_N_VOXEL_PER_THREAD - 1) / RECONSTRUCT_N_VOXEL_PER_THREAD);
+
+    nThread = GSL_MIN_INT(GSL_MAX_INT(nThread, 1), _para.nThreadsPerProcess);
+
+    return GSL_MAX_INT(GSL_MIN_INT(_para.k, _para.nThreadsPerProcess / nThread), 1);
+}
+
 void Optimiser::run()
 {
     //MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Initialising Optimiser";
@@ -3585,7 +3853,7 @@ void Optimiser::run()
     saveLowPassImages();
     ***/
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
 #ifdef OPTIMISER_SAVE_SIGMA
     saveSig();
@@ -3625,7 +3893,7 @@ void Optimiser::run()
             break;
         }
 
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         if ((_iter == 0) || (!_para.skipE))
         {
@@ -3675,7 +3943,7 @@ void Optimiser::run()
                                        << " Images";
 #endif
 
-            MPI_Barrier(MPI_COMM_WORLD);
+            waitAll();
 
             MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "All Processes Finishing Expectation";
 
@@ -3696,20 +3964,23 @@ void Optimiser::run()
                                        << t;
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Percentage of Images Belonging to Each Class Determined";
 #endif
 
 #ifdef OPTIMISER_SAVE_BEST_PROJECTIONS
 
-        MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving Best Projections";
-        saveBestProjections();
+        if (_iter % GSL_MAX_INT(1, _para.saveImgIterInterval) == 0)
+        {
+            MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving Best Projections";
+            saveBestProjections();
+        }
 
 #endif
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Best Projections Saved";
 #endif
@@ -3721,7 +3992,7 @@ void Optimiser::run()
             saveDatabase();
 
 #ifdef VERBOSE_LEVEL_1
-            MPI_Barrier(MPI_COMM_WORLD);
+            waitAll();
 
             MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Database Saved";
 #endif
@@ -3732,7 +4003,7 @@ void Optimiser::run()
         refreshVariance();
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Variance of Rotation and Translation Calculated";
 #endif
@@ -3758,7 +4029,7 @@ void Optimiser::run()
                                    << _model.stdTVariS1();
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Variance of Rotation and Translation Calculated";
 #endif
@@ -3767,7 +4038,7 @@ void Optimiser::run()
         refreshRotationChange();
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Changes of Rotation Between Iterations Calculated";
 #endif
@@ -3881,7 +4152,7 @@ void Optimiser::run()
         saveSig();
 #endif
 
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Maximization Performed";
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Calculating SNR(s)";
@@ -4096,7 +4367,7 @@ void Optimiser::run()
     }
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Image Stacks Freed";
 #endif
@@ -4108,11 +4379,11 @@ void Optimiser::run()
     NT_MASTER
     {
         for (int t = 0; t < _para.k; t++)
-            _model.reco(t).allocSpace(_para.nThreadsPerProcess);
+            _model.reco(t).allocSpace(nThreadReco());
     }
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Space Allocated in Reconstructor(s)";
 #endif
@@ -4137,13 +4408,13 @@ void Optimiser::run()
     }
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Space Freed in Reconstructor(s)";
 #endif
 
 #ifdef VERBOSE_LEVEL_1
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Final Reference(s) Reconstructed";
 #endif
@@ -4225,7 +4496,7 @@ void Optimiser::run()
             _model.avgHemi();
 
 #ifdef VERBOSE_LEVEL_1
-            MPI_Barrier(MPI_COMM_WORLD);
+            waitAll();
 
             MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reference(s) From Two Hemispheres Averaged";
 #endif
@@ -4268,7 +4539,7 @@ void Optimiser::run()
                 normCorrection();
 
 #ifdef VERBOSE_LEVEL_1
-                MPI_Barrier(MPI_COMM_WORLD);
+                waitAll();
 
                 MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Noise Normalised";
 #endif
@@ -4283,7 +4554,7 @@ void Optimiser::run()
                 }
 
 #ifdef VERBOSE_LEVEL_1
-                MPI_Barrier(MPI_COMM_WORLD);
+                waitAll();
 
                 MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reconstructors Refreshed";
 #endif
@@ -4293,11 +4564,11 @@ void Optimiser::run()
                 NT_MASTER
                 {
                     for (int t = 0; t < _para.k; t++)
-                    _model.reco(t).allocSpace(_para.nThreadsPerProcess);
+                    _model.reco(t).allocSpace(nThreadReco());
                 }
 
 #ifdef VERBOSE_LEVEL_1
-                MPI_Barrier(MPI_COMM_WORLD);
+                waitAll();
 
                 MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Space Allocated in Reconstructor(s)";
 #endif
@@ -4316,14 +4587,14 @@ void Optimiser::run()
 
 
 #ifdef VERBOSE_LEVEL_1
-                MPI_Barrier(MPI_COMM_WORLD);
+                waitAll();
 
                 MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "References(s) at Nyquist After Normalising Noise Reconstructed";
 #endif
             }
 
 #ifdef VERBOSE_LEVEL_1
-            MPI_Barrier(MPI_COMM_WORLD);
+            waitAll();
 
             MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Finishing Pass " << pass << " of Subtraction";
 #endif
@@ -4335,7 +4606,7 @@ void Optimiser::run()
         saveBestProjections();
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Best Projections Saved";
 #endif
@@ -4347,7 +4618,7 @@ void Optimiser::run()
         saveSubtract();
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Masked Region Reference Subtracted Images Saved";
 #endif
@@ -4356,7 +4627,7 @@ void Optimiser::run()
         saveDatabase(false, true);
 
 #ifdef VERBOSE_LEVEL_1
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
         MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Database of Masked Region Reference Subtracted Images Saved";
 #endif
@@ -4368,6 +4639,8 @@ void Optimiser::clear()
     _img.clear();
     _par.clear();
     _ctf.clear();
+
+    _model.clear();
 }
 
 void Optimiser::bCastNPar()
@@ -4595,6 +4868,8 @@ void Optimiser::initMask()
     imf.readMetaData();
 
     imf.readVolume(_mask);
+
+    _solventWeightKind = SOLVENT_WEIGHT_NONE;
 }
 
 void Optimiser::initID()
@@ -5219,13 +5494,13 @@ void Optimiser::initSigma()
     BLOG(INFO, "LOGGER_INIT") << "Calculating Expectation for Initializing Sigma";
 
     vec psAvg(maxR());
-    for (int i = 0; i < maxR(); i++)
-    {
-        psAvg(i) = ringAverage(i,
-                               avg,
-                               function<RFLOAT(const Complex)>(&gsl_real_imag_sum));
-        psAvg(i) = TSGSL_pow_2(psAvg(i));
-    }
+
+    ringAverage(psAvg,
+                avg,
+                function<RFLOAT(const Complex)>(&gsl_real_imag_sum),
+                maxR());
+
+    psAvg = psAvg.array().square();
 
     // avgPs -> average power spectrum
     // psAvg -> expectation of pixels
@@ -5256,6 +5531,8 @@ void Optimiser::initParticles()
         ALOG(INFO, "LOGGER_SYS") << "Initialising Particle Filter for Image " << _ID[l];
         BLOG(INFO, "LOGGER_SYS") << "Initialising Particle Filter for Image " << _ID[l];
 #endif
+        seed_random_engine(0, _ID[l], -1);
+
         _par[l].init(_para.mode,
                      _para.transS,
                      TRANS_Q,
@@ -5357,6 +5634,8 @@ void Optimiser::loadParticles()
             score = _db.score(_ID[l]);
         }
 
+        seed_random_engine(0, _ID[l], -1);
+
         _par[l].load(_para.mLR,
                      _para.mLT,
                      1,
@@ -5492,6 +5771,8 @@ void Optimiser::refreshClassDistr()
         #pragma omp parallel for private(cls)
         FOR_EACH_2D_IMAGE
         {
+            seed_random_engine(_iter, _ID[l], RANDOM_PHASE_CLASS_DISTR);
+
             for (int k = 0; k < _para.k; k++)
             {
                 _par[l].rand(cls);
@@ -5502,7 +5783,7 @@ void Optimiser::refreshClassDistr()
         }
     }
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MPI_Allreduce(MPI_IN_PLACE,
                   _cDistr.data(),
@@ -5638,6 +5919,8 @@ void Optimiser::refreshVariance()
         #pragma omp parallel for private(rVari, tVariS0, tVariS1, dVari)
         FOR_EACH_2D_IMAGE
         {
+            seed_random_engine(_iter, _ID[l], RANDOM_PHASE_VARIANCE);
+
 #ifdef OPTIMISER_REFRESH_VARIANCE_BEST_CLASS
             size_t cls;
             _par[l].rand(cls);
@@ -5669,7 +5952,7 @@ void Optimiser::refreshVariance()
         }
     }
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MPI_Allreduce(MPI_IN_PLACE,
                   rv.data(),
@@ -5692,7 +5975,7 @@ void Optimiser::refreshVariance()
                   MPI_SUM,
                   MPI_COMM_WORLD);
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
 #ifdef OPTIMISER_REFRESH_VARIANCE_BEST_CLASS
     int num = 0;
@@ -5948,7 +6231,7 @@ void Optimiser::refreshScale(const bool coord,
     ILOG(INFO, "LOGGER_SYS") << "Intensity Scale Information Calculated";
 #endif
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Accumulating Intensity Scale Information from All Processes";
 
@@ -6356,7 +6639,7 @@ void Optimiser::normCorrection()
         }
     }
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MPI_Allreduce(MPI_IN_PLACE,
                   norm.data(),
@@ -6365,7 +6648,7 @@ void Optimiser::normCorrection()
                   MPI_SUM,
                   MPI_COMM_WORLD);
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     MLOG(INFO, "LOGGER_SYS") << "Max of Norm of Noise : "
                              << TSGSL_stats_max(norm.data(), 1, norm.size());
@@ -6443,6 +6726,8 @@ void Optimiser::allReduceSigma(const bool mask,
     #pragma omp parallel for private(cls, rot2D, rot3D, tran, d) schedule(dynamic)
     FOR_EACH_2D_IMAGE
     {
+        seed_random_engine(_iter, _ID[l], RANDOM_PHASE_SIGMA);
+
 #ifdef OPTIMISER_SIGMA_RANK1ST
         for (int m = 0; m < 1; m++)
 #else
@@ -6601,75 +6886,413 @@ void Optimiser::allReduceSigma(const bool mask,
 
     delete[] mtx;
 
-    MPI_Barrier(_hemi);
+    reduceSigma(sigM, sigN, rSig, group);
+}
 
-    ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Averaging Sigma of Images Belonging to the Same Group";
-    BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Averaging Sigma of Images Belonging to the Same Group";
+#ifdef OPTIMISER_NORM_SIGMA_ONE_PASS
+void Optimiser::normSigmaOnePass(const bool norm,
+                                 const bool group)
+{
+    RFLOAT rNorm = TSGSL_MIN_RFLOAT(_r, _model.resolutionP(0.75, false));
 
-    MPI_Allreduce(MPI_IN_PLACE,
-                  sigM.data(),
-                  rSig * _nGroup,
-                  TS_MPI_DOUBLE,
-                  MPI_SUM,
-                  _hemi);
+#ifdef OPTIMISER_SIGMA_WHOLE_FREQUENCY
+    int rSig = maxR();
+#else
+    int rSig = _r;
+#endif
 
-    MPI_Allreduce(MPI_IN_PLACE,
-                  sigM.col(sigM.cols() - 1).data(),
-                  _nGroup,
-                  TS_MPI_DOUBLE,
-                  MPI_SUM,
-                  _hemi);
+    vec normV = vec::Zero(_nPar);
 
-    MPI_Allreduce(MPI_IN_PLACE,
-                  sigN.data(),
-                  rSig * _nGroup,
-                  TS_MPI_DOUBLE,
-                  MPI_SUM,
-                  _hemi);
+    // For image l scaled by s = sqrt(m / n_l), where n_l is the power of its
+    // remain and m the median of n_l, the power of the remain in each shell is
+    // |s * I - P|^2 = m / n_l * |I|^2 - 2 * sqrt(m / n_l) * Re(I * P') + |P|^2.
+    // Accumulating the three terms separately lets the norm correction and the
+    // sigma share one projection per image before m is known.
 
-    MPI_Allreduce(MPI_IN_PLACE,
-                  sigN.col(sigN.cols() - 1).data(),
-                  _nGroup,
-                  TS_MPI_DOUBLE,
-                  MPI_SUM,
-                  _hemi);
+    dmat sumII = dmat::Zero(_nGroup, rSig);
+    dmat sumIP = dmat::Zero(_nGroup, rSig);
+    dmat sumPP = dmat::Zero(_nGroup, rSig);
 
-    MPI_Allreduce(MPI_IN_PLACE,
-                  _svd.data(),
-                  rSig * _nGroup,
-                  TS_MPI_DOUBLE,
-                  MPI_SUM,
-                  _hemi);
+    dmat sumIIOri = dmat::Zero(_nGroup, rSig);
+    dmat sumIPOri = dmat::Zero(_nGroup, rSig);
+    dmat sumPPOri = dmat::Zero(_nGroup, rSig);
 
-    MPI_Allreduce(MPI_IN_PLACE,
-                  _svd.col(_svd.cols() - 1).data(),
-                  _nGroup,
-                  TS_MPI_DOUBLE,
-                  MPI_SUM,
-                  _hemi);
+    dmat sumSVD = dmat::Zero(_nGroup, rSig);
 
-    MPI_Barrier(_hemi);
+    dvec sumW = dvec::Zero(_nGroup);
 
-    if (group)
-    {
-        #pragma omp parallel for
-        for (int i = 0; i < _sig.rows(); i++)
-        {
-            sigM.row(i).head(rSig) /= sigM(i, sigM.cols() - 1);
-            sigN.row(i).head(rSig) /= sigN(i, sigN.cols() - 1);
-            _svd.row(i).head(rSig) /= _svd(i, _svd.cols() - 1);
-        }
-    }
-    else
+    NT_MASTER
     {
-        sigM.row(0).head(rSig) /= sigM(0, sigM.cols() - 1);
-        sigN.row(0).head(rSig) /= sigN(0, sigN.cols() - 1);
-        _svd.row(0).head(rSig) /= _svd(0, _svd.cols() - 1);
+        ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Calculating Remains of Images for Norm and Sigma";
+        BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Calculating Remains of Images for Norm and Sigma";
+
+        omp_lock_t* mtx = new omp_lock_t[_nGroup];
 
         #pragma omp parallel for
-        for (int i = 1; i < _sig.rows(); i++)
-        {
-            sigM.row(i).head(rSig) = sigM.row(0).head(rSig);
+        for (int l = 0; l < _nGroup; l++)
+            omp_init_lock(&mtx[l]);
+
+        #pragma omp parallel for schedule(dynamic)
+        FOR_EACH_2D_IMAGE
+        {
+#ifdef OPTIMIDSER_SIGMA_GRADING
+            RFLOAT w;
+
+            if (_para.parGra)
+                w = _par[l].compressR();
+            else
+                w = 1;
+#else
+            RFLOAT w = 1;
+#endif
+
+            size_t cls;
+            dvec2 tran;
+            double d;
+
+            Image imgM(size(), size(), FT_SPACE);
+            Image imgN(size(), size(), FT_SPACE);
+
+            SET_0_FT(imgM);
+            SET_0_FT(imgN);
+
+            if (_para.mode == MODE_2D)
+            {
+                dmat22 rot2D;
+
+                _par[l].rank1st(cls, rot2D, tran, d);
+
+                _model.proj(cls).project(imgM, rot2D, tran, 1);
+#ifdef OPTIMISER_RECENTRE_IMAGE_EACH_ITERATION
+                _model.proj(cls).project(imgN, rot2D, tran - _offset[l], 1);
+#else
+                _model.proj(cls).project(imgN, rot2D, tran, 1);
+#endif
+            }
+            else if (_para.mode == MODE_3D)
+            {
+                dmat33 rot3D;
+
+                _par[l].rank1st(cls, rot3D, tran, d);
+
+                _model.proj(cls).project(imgM, rot3D, tran, 1);
+#ifdef OPTIMISER_RECENTRE_IMAGE_EACH_ITERATION
+                _model.proj(cls).project(imgN, rot3D, tran - _offset[l], 1);
+#else
+                _model.proj(cls).project(imgN, rot3D, tran, 1);
+#endif
+            }
+            else
+            {
+                REPORT_ERROR("INEXISTENT MODE");
+
+                abort();
+            }
+
+            if (_searchType != SEARCH_TYPE_CTF)
+            {
+#ifdef OPTIMISER_CTF_ON_THE_FLY
+                Image ctf(_para.size, _para.size, FT_SPACE);
+
+                SET_0_FT(ctf);
+
+                CTF(ctf,
+                    _para.pixelSize,
+                    _ctfAttr[l].voltage,
+                    _ctfAttr[l].defocusU,
+                    _ctfAttr[l].defocusV,
+                    _ctfAttr[l].defocusTheta,
+                    _ctfAttr[l].Cs,
+                    _ctfAttr[l].amplitudeContrast,
+                    _ctfAttr[l].phaseShift,
+                    CEIL(rSig) + 1,
+                    1);
+
+                FOR_EACH_PIXEL_FT(imgM)
+                {
+                    imgM[i] *= REAL(ctf[i]);
+                    imgN[i] *= REAL(ctf[i]);
+                }
+#else
+                FOR_EACH_PIXEL_FT(imgM)
+                {
+                    imgM[i] *= REAL(_ctf[l][i]);
+                    imgN[i] *= REAL(_ctf[l][i]);
+                }
+#endif
+            }
+            else
+            {
+                Image ctf(_para.size, _para.size, FT_SPACE);
+
+                SET_0_FT(ctf);
+
+                CTF(ctf,
+                    _para.pixelSize,
+                    _ctfAttr[l].voltage,
+                    _ctfAttr[l].defocusU * d,
+                    _ctfAttr[l].defocusV * d,
+                    _ctfAttr[l].defocusTheta,
+                    _ctfAttr[l].Cs,
+                    _ctfAttr[l].amplitudeContrast,
+                    _ctfAttr[l].phaseShift,
+                    1);
+
+                FOR_EACH_PIXEL_FT(imgM)
+                {
+                    imgM[i] *= REAL(ctf[i]);
+                    imgN[i] *= REAL(ctf[i]);
+                }
+            }
+
+#ifndef NAN_NO_CHECK
+            SEGMENT_NAN_CHECK_COMPLEX(imgM.dataFT(), imgM.sizeFT());
+#endif
+
+#ifdef OPTIMISER_ADJUST_2D_IMAGE_NOISE_ZERO_MEAN
+            if (norm)
+            {
+                _img[l][0] = imgM[0];
+                _imgOri[l][0] = imgM[0];
+            }
+#endif
+
+            double n = 0;
+
+            dvec ii = dvec::Zero(rSig);
+            dvec ip = dvec::Zero(rSig);
+            dvec pp = dvec::Zero(rSig);
+
+            dvec iiOri = dvec::Zero(rSig);
+            dvec ipOri = dvec::Zero(rSig);
+            dvec ppOri = dvec::Zero(rSig);
+
+            uvec counter = uvec::Zero(rSig);
+
+            IMAGE_FOR_EACH_PIXEL_FT(imgM)
+            {
+                RFLOAT r2 = QUAD(i, j);
+
+                if (r2 >= TSGSL_pow_2(rSig)) continue;
+
+                Complex img = _img[l].getFTHalf(i, j);
+                Complex pri = imgM.getFTHalf(i, j);
+
+                if ((r2 >= TSGSL_pow_2(_rL)) &&
+                    (r2 < TSGSL_pow_2(rNorm)))
+                    n += ABS2(img - pri);
+
+                int u = AROUND(NORM(i, j));
+
+                if (u < rSig)
+                {
+                    Complex imgOri = _imgOri[l].getFTHalf(i, j);
+                    Complex priOri = imgN.getFTHalf(i, j);
+
+                    ii(u) += ABS2(img);
+                    ip(u) += REAL(img * CONJUGATE(pri));
+                    pp(u) += ABS2(pri);
+
+                    iiOri(u) += ABS2(imgOri);
+                    ipOri(u) += REAL(imgOri * CONJUGATE(priOri));
+                    ppOri(u) += ABS2(priOri);
+
+                    counter(u) += 1;
+                }
+            }
+
+            for (int i = 0; i < rSig; i++)
+            {
+                ii(i) /= counter(i);
+                ip(i) /= counter(i);
+                pp(i) /= counter(i);
+
+                iiOri(i) /= counter(i);
+                ipOri(i) /= counter(i);
+                ppOri(i) /= counter(i);
+            }
+
+            if (norm) normV(_ID[l]) = n;
+
+            // m / n_l = m * a, sqrt(m / n_l) = sqrt(m) * b
+            double a = norm ? 1.0 / n : 1;
+            double b = norm ? 1.0 / sqrt(n) : 1;
+
+            int g = group ? _groupID[l] - 1 : 0;
+
+            omp_set_lock(&mtx[g]);
+
+            sumII.row(g) += w * a * ii.transpose();
+            sumIP.row(g) += w * b * ip.transpose();
+            sumPP.row(g) += w * pp.transpose();
+
+            sumIIOri.row(g) += w * a * iiOri.transpose();
+            sumIPOri.row(g) += w * b * ipOri.transpose();
+            sumPPOri.row(g) += w * ppOri.transpose();
+
+            // sqrt(|P|^2 / (m / n_l * |I|^2)) = sqrt(|P|^2 / |I|^2) / (sqrt(m) * b)
+            for (int i = 0; i < rSig; i++)
+                sumSVD(g, i) += w * sqrt(pp(i) / ii(i)) / b;
+
+            sumW(g) += w;
+
+            omp_unset_lock(&mtx[g]);
+        }
+
+        delete[] mtx;
+    }
+
+    RFLOAT m = 1;
+
+    if (norm)
+    {
+        waitAll();
+
+        MPI_Allreduce(MPI_IN_PLACE,
+                      normV.data(),
+                      normV.size(),
+                      TS_MPI_DOUBLE,
+                      MPI_SUM,
+                      MPI_COMM_WORLD);
+
+        waitAll();
+
+        MLOG(INFO, "LOGGER_SYS") << "Max of Norm of Noise : "
+                                 << TSGSL_stats_max(normV.data(), 1, normV.size());
+
+        MLOG(INFO, "LOGGER_SYS") << "Min of Norm of Noise : "
+                                 << TSGSL_stats_min(normV.data(), 1, normV.size());
+
+        m = median(normV, normV.size());
+
+        MLOG(INFO, "LOGGER_SYS") << "Mean of Norm of Noise : "
+                                 << m;
+    }
+
+    IF_MASTER return;
+
+    if (norm)
+    {
+        #pragma omp parallel for
+        FOR_EACH_2D_IMAGE
+        {
+            FOR_EACH_PIXEL_FT(_img[l])
+            {
+                _img[l][i] *= sqrt(m / normV(_ID[l]));
+                _imgOri[l][i] *= sqrt(m / normV(_ID[l]));
+            }
+        }
+    }
+
+    ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Recalculating Sigma";
+    BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Recalculating Sigma";
+
+    _sig.leftCols(rSig).setZero();
+    _sig.rightCols(1).setZero();
+
+    mat sigM = mat::Zero(_sig.rows(), _sig.cols());
+    mat sigN = mat::Zero(_sig.rows(), _sig.cols());
+
+    _svd.leftCols(rSig).setZero();
+    _svd.rightCols(1).setZero();
+
+    sigM.leftCols(rSig) = ((m * sumII - 2 * sqrt(m) * sumIP + sumPP) / 2).cast<RFLOAT>();
+    sigN.leftCols(rSig) = ((m * sumIIOri - 2 * sqrt(m) * sumIPOri + sumPPOri) / 2).cast<RFLOAT>();
+    _svd.leftCols(rSig) = (sumSVD / sqrt(m)).cast<RFLOAT>();
+
+    sigM.rightCols(1) = sumW.cast<RFLOAT>();
+    sigN.rightCols(1) = sumW.cast<RFLOAT>();
+    _svd.rightCols(1) = sumW.cast<RFLOAT>();
+
+    reduceSigma(sigM, sigN, rSig, group);
+}
+#endif
+
+void Optimiser::reduceSigma(mat& sigM,
+                            mat& sigN,
+                            const int rSig,
+                            const bool group)
+{
+    MPI_Barrier(_hemi);
+
+    ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Averaging Sigma of Images Belonging to the Same Group";
+    BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Averaging Sigma of Images Belonging to the Same Group";
+
+    // the six reducings are in flight at the same time
+    MPI_Request req[6];
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   sigM.data(),
+                   rSig * _nGroup,
+                   TS_MPI_DOUBLE,
+                   MPI_SUM,
+                   _hemi,
+                   &req[0]);
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   sigM.col(sigM.cols() - 1).data(),
+                   _nGroup,
+                   TS_MPI_DOUBLE,
+                   MPI_SUM,
+                   _hemi,
+                   &req[1]);
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   sigN.data(),
+                   rSig * _nGroup,
+                   TS_MPI_DOUBLE,
+                   MPI_SUM,
+                   _hemi,
+                   &req[2]);
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   sigN.col(sigN.cols() - 1).data(),
+                   _nGroup,
+                   TS_MPI_DOUBLE,
+                   MPI_SUM,
+                   _hemi,
+                   &req[3]);
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   _svd.data(),
+                   rSig * _nGroup,
+                   TS_MPI_DOUBLE,
+                   MPI_SUM,
+                   _hemi,
+                   &req[4]);
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   _svd.col(_svd.cols() - 1).data(),
+                   _nGroup,
+                   TS_MPI_DOUBLE,
+                   MPI_SUM,
+                   _hemi,
+                   &req[5]);
+
+    MPI_Waitall(6, req, MPI_STATUSES_IGNORE);
+
+    MPI_Barrier(_hemi);
+
+    if (group)
+    {
+        #pragma omp parallel for
+        for (int i = 0; i < _sig.rows(); i++)
+        {
+            sigM.row(i).head(rSig) /= sigM(i, sigM.cols() - 1);
+            sigN.row(i).head(rSig) /= sigN(i, sigN.cols() - 1);
+            _svd.row(i).head(rSig) /= _svd(i, _svd.cols() - 1);
+        }
+    }
+    else
+    {
+        sigM.row(0).head(rSig) /= sigM(0, sigM.cols() - 1);
+        sigN.row(0).head(rSig) /= sigN(0, sigN.cols() - 1);
+        _svd.row(0).head(rSig) /= _svd(0, _svd.cols() - 1);
+
+        #pragma omp parallel for
+        for (int i = 1; i < _sig.rows(); i++)
+        {
+            sigM.row(i).head(rSig) = sigM.row(0).head(rSig);
             sigN.row(i).head(rSig) = sigN.row(0).head(rSig);
             _svd.row(i).head(rSig) = _svd.row(0).head(rSig);
         }
@@ -6759,6 +7382,8 @@ void Optimiser::reconstructRef(const bool fscFlag,
             #pragma omp parallel for
             FOR_EACH_2D_IMAGE
             {
+                seed_random_engine(_iter, _ID[l], RANDOM_PHASE_INSERT);
+
                 if (_para.parGra && _para.k == 1)
                     w[l] = _par[l].compressR();
                 else
@@ -6865,6 +7490,8 @@ void Optimiser::reconstructRef(const bool fscFlag,
                 #pragma omp parallel for
                 FOR_EACH_2D_IMAGE
                 {
+                    seed_random_engine(_iter, _ID[l], RANDOM_PHASE_INSERT);
+
                     if (_para.parGra && _para.k == 1)
                         w[l] = _par[l].compressR();
                     else
@@ -6918,6 +7545,8 @@ void Optimiser::reconstructRef(const bool fscFlag,
                         #pragma omp parallel for
                         FOR_EACH_2D_IMAGE
                         {
+                            seed_random_engine(_iter, _ID[l], RANDOM_PHASE_INSERT + 1 + t);
+
                             int shift = l * temp;
                             for (int m = 0; m < temp; m++)
                             {
@@ -6969,6 +7598,8 @@ void Optimiser::reconstructRef(const bool fscFlag,
                 #pragma omp parallel for
                 FOR_EACH_2D_IMAGE
                 {
+                    seed_random_engine(_iter, _ID[l], RANDOM_PHASE_INSERT);
+
                     if (_para.parGra && _para.k == 1)
                         w[l] = _par[l].compressR();
                     else
@@ -7033,11 +7664,21 @@ void Optimiser::reconstructRef(const bool fscFlag,
         }
 
 #else
+        for (int t = 0; t < _para.k; t++)
+        {
+            _model.reco(t).setSymInsert(_para.symInsert);
+            _model.reco(t).setKernelType(_para.mkbInsert
+                                       ? RECONSTRUCTOR_KERNEL_MKB
+                                       : RECONSTRUCTOR_KERNEL_TRILINEAR);
+        }
+
         Complex* poolTransImgP = (Complex*)TSFFTW_malloc(_nPxl * omp_get_max_threads() * sizeof(Complex));
 
         #pragma omp parallel for
         FOR_EACH_2D_IMAGE
         {
+            seed_random_engine(_iter, _ID[l], RANDOM_PHASE_INSERT);
+
             RFLOAT* ctf;
 
             RFLOAT w;
@@ -7103,24 +7744,18 @@ void Optimiser::reconstructRef(const bool fscFlag,
                         ctf = (RFLOAT*)TSFFTW_malloc(_nPxl * sizeof(RFLOAT));
 
                         CTF(ctf,
-                            _para.pixelSize,
+                            _ctfGeom,
                             _ctfAttr[l].voltage,
                             _ctfAttr[l].defocusU * d,
                             _ctfAttr[l].defocusV * d,
                             _ctfAttr[l].defocusTheta,
                             _ctfAttr[l].Cs,
                             _ctfAttr[l].amplitudeContrast,
-                            _ctfAttr[l].phaseShift,
-                            _para.size,
-                            _para.size,
-                            _iCol,
-                            _iRow,
-                            _nPxl,
-                            1);
+                            _ctfAttr[l].phaseShift);
                     }
                     else
                     {
-                        ctf = _ctfP + _nPxl * l;
+                        ctf = _ctfP + _nPxl * _iCtfP[l];
                     }
 
 #ifdef OPTIMISER_RECONSTRUCT_SIGMA_REGULARISE
@@ -7185,24 +7820,18 @@ void Optimiser::reconstructRef(const bool fscFlag,
                         ctf = (RFLOAT*)TSFFTW_malloc(_nPxl * sizeof(RFLOAT));
 
                         CTF(ctf,
-                            _para.pixelSize,
+                            _ctfGeom,
                             _ctfAttr[l].voltage,
                             _ctfAttr[l].defocusU * d,
                             _ctfAttr[l].defocusV * d,
                             _ctfAttr[l].defocusTheta,
                             _ctfAttr[l].Cs,
                             _ctfAttr[l].amplitudeContrast,
-                            _ctfAttr[l].phaseShift,
-                            _para.size,
-                            _para.size,
-                            _iCol,
-                            _iRow,
-                            _nPxl,
-                            1);
+                            _ctfAttr[l].phaseShift);
                     }
                     else
                     {
-                        ctf = _ctfP + _nPxl * l;
+                        ctf = _ctfP + _nPxl * _iCtfP[l];
                     }
 
 #ifdef OPTIMISER_RECONSTRUCT_SIGMA_REGULARISE
@@ -7253,6 +7882,12 @@ void Optimiser::reconstructRef(const bool fscFlag,
         int deviceNum = gpus.size();
 #endif
 
+#ifndef GPU_VERSION
+        // all reducing of a reference overlaps the preparation of the former ones
+        for (int t = 0; t < _para.k; t++)
+            _model.reco(t).startAllReduceTF();
+#endif
+
 #ifdef GPU_RECONSTRUCT
         #pragma omp parallel for num_threads(deviceNum)
 #endif
@@ -7302,7 +7937,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
         }
     }
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
 #ifdef OPTIMISER_BALANCE_CLASS
     umat2 bm;
@@ -7320,8 +7955,27 @@ void Optimiser::reconstructRef(const bool fscFlag,
             int deviceNum = gpus.size();
 #endif
 
+            int nThread = nThreadReco();
+
 #ifdef GPU_RECONSTRUCT
             #pragma omp parallel for num_threads(deviceNum)
+#else
+            int nLevel = omp_get_max_active_levels();
+
+            omp_set_max_active_levels(2);
+
+            ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reconstructing "
+                                       << nConcReco()
+                                       << " Reference(s) Concurrently, "
+                                       << nThread
+                                       << " Thread(s) Each";
+            BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reconstructing "
+                                       << nConcReco()
+                                       << " Reference(s) Concurrently, "
+                                       << nThread
+                                       << " Thread(s) Each";
+
+            #pragma omp parallel for schedule(dynamic) num_threads(nConcReco())
 #endif
             for (int t = 0; t < _para.k; t++)
             {
@@ -7368,7 +8022,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
 #ifdef GPU_RECONSTRUCT
                 _model.reco(t).reconstructG(ref, gpus[omp_get_thread_num()], 1);
 #else
-                _model.reco(t).reconstruct(ref, _para.nThreadsPerProcess);
+                _model.reco(t).reconstruct(ref, nThread);
 
 #ifndef NAN_NO_CHECK
                 SEGMENT_NAN_CHECK(ref.dataRL(), ref.sizeRL());
@@ -7379,7 +8033,9 @@ void Optimiser::reconstructRef(const bool fscFlag,
                 BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Fourier Transforming Reference " << t;
 #endif
 
-                fft.fw(ref, _para.nThreadsPerProcess);
+                FFT fft;
+
+                fft.fw(ref, nThread);
 
 #endif
 
@@ -7405,7 +8061,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
                                      -_model.reco(t).oy(),
                                       _model.rU());
 #else
-                        translate(img, img, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), _para.nThreadsPerProcess);
+                        translate(img, img, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), nThread);
 #endif
 
                         SLC_REPLACE_FT(ref, img, 0);
@@ -7422,7 +8078,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
                                        -_model.reco(t).oz(),
                                        _model.rU());
 #else
-                            translate(ref, ref, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), -_model.reco(t).oz(), _para.nThreadsPerProcess);
+                            translate(ref, ref, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), -_model.reco(t).oz(), nThread);
 #endif
                         }
                     }
@@ -7436,7 +8092,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
                 SEGMENT_NAN_CHECK_COMPLEX(ref.dataFT(), ref.sizeFT());
 #endif
 
-                #pragma omp parallel for
+                #pragma omp parallel for num_threads(nThread)
                 SET_0_FT(_model.ref(t));
 
                 COPY_FT(_model.ref(t), ref);
@@ -7446,6 +8102,10 @@ void Optimiser::reconstructRef(const bool fscFlag,
                 BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reference " << t << "Fourier Transformed";
 #endif
             }
+
+#ifndef GPU_RECONSTRUCT
+            omp_set_max_active_levels(nLevel);
+#endif
         }
 
 #ifndef NAN_NO_CHECK
@@ -7503,7 +8163,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
         }
 #endif
 
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
 #ifdef OPTIMISER_BALANCE_CLASS
 
@@ -7568,8 +8228,27 @@ void Optimiser::reconstructRef(const bool fscFlag,
             int deviceNum = gpus.size();
 #endif
 
+            int nThread = nThreadReco();
+
 #ifdef GPU_RECONSTRUCT
             #pragma omp parallel for num_threads(deviceNum)
+#else
+            int nLevel = omp_get_max_active_levels();
+
+            omp_set_max_active_levels(2);
+
+            ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reconstructing "
+                                       << nConcReco()
+                                       << " Reference(s) Concurrently, "
+                                       << nThread
+                                       << " Thread(s) Each";
+            BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reconstructing "
+                                       << nConcReco()
+                                       << " Reference(s) Concurrently, "
+                                       << nThread
+                                       << " Thread(s) Each";
+
+            #pragma omp parallel for schedule(dynamic) num_threads(nConcReco())
 #endif
             for (int t = 0; t < _para.k; t++)
             {
@@ -7616,14 +8295,16 @@ void Optimiser::reconstructRef(const bool fscFlag,
 #ifdef GPU_RECONSTRUCT
                 _model.reco(t).reconstructG(ref, gpus[omp_get_thread_num()], 1);
 #else
-                _model.reco(t).reconstruct(ref, _para.nThreadsPerProcess);
+                _model.reco(t).reconstruct(ref, nThread);
 
 #ifdef VERBOSE_LEVEL_2
                 ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Fourier Transforming Reference " << t;
                 BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Fourier Transforming Reference " << t;
 #endif
 
-                fft.fw(ref, _para.nThreadsPerProcess);
+                FFT fft;
+
+                fft.fw(ref, nThread);
 
 #endif
 
@@ -7645,7 +8326,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
                                      -_model.reco(t).oy(),
                                      _model.rU());
 #else
-                        translate(img, img, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), _para.nThreadsPerProcess);
+                        translate(img, img, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), nThread);
 #endif
 
                         SLC_REPLACE_FT(ref, img, 0);
@@ -7662,7 +8343,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
                                        -_model.reco(t).oz(),
                                        _model.rU());
 #else
-                            translate(ref, ref, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), -_model.reco(t).oz(), _para.nThreadsPerProcess);
+                            translate(ref, ref, _model.rU(), -_model.reco(t).ox(), -_model.reco(t).oy(), -_model.reco(t).oz(), nThread);
 #endif
                         }
                     }
@@ -7672,7 +8353,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
                     }
                 }
 
-                #pragma omp parallel for
+                #pragma omp parallel for num_threads(nThread)
                 SET_0_FT(_model.ref(t));
 
                 COPY_FT(_model.ref(t), ref);
@@ -7682,6 +8363,10 @@ void Optimiser::reconstructRef(const bool fscFlag,
                 BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reference " << t << "Fourier Transformed";
 #endif
             }
+
+#ifndef GPU_RECONSTRUCT
+            omp_set_max_active_levels(nLevel);
+#endif
         }
 
 
@@ -7720,7 +8405,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
             }
         }
 
-        MPI_Barrier(MPI_COMM_WORLD);
+        waitAll();
 
 #ifdef OPTIMISER_BALANCE_CLASS
 
@@ -7759,7 +8444,7 @@ void Optimiser::reconstructRef(const bool fscFlag,
 
     freePreCalIdx();
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    waitAll();
 
     ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reference(s) Reconstructed";
     BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Reference(s) Reconstructed";
@@ -7774,6 +8459,17 @@ void Optimiser::solventFlatten(const bool mask)
 
     IF_MASTER return;
 
+    bool maskRef = mask && !_mask.isEmptyRL();
+
+    if (maskRef && (_para.mode == MODE_2D))
+    {
+        REPORT_ERROR("2D MODE DO NOT SUPPORTS PROVIDED MASK");
+
+        abort();
+    }
+
+    const Volume& weight = solventWeight(maskRef);
+
     for (int t = 0; t < _para.k; t++)
     {
 #ifdef OPTIMISER_SOLVENT_FLATTEN_LOW_PASS
@@ -7790,8 +8486,7 @@ void Optimiser::solventFlatten(const bool mask)
         ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Inverse Fourier Transforming Reference " << t;
         BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Inverse Fourier Transforming Reference " << t;
 
-        FFT fft;
-        fft.bw(_model.ref(t), _para.nThreadsPerProcess);
+        _fftRef.bwExecutePlan(_model.ref(t), _para.nThreadsPerProcess);
 
 #ifdef OPTIMISER_SOLVENT_FLATTEN_STAT_REMOVE_BG
 
@@ -7872,120 +8567,105 @@ void Optimiser::solventFlatten(const bool mask)
         REMOVE_NEG(_model.ref(t));
 #endif
 
-        if (mask && !_mask.isEmptyRL())
+        if (maskRef)
         {
             ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Performing Reference Masking";
             BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Performing Reference Masking";
+        }
+        else
+        {
+            ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Performing Solvent Flatten of Reference " << t;
+            BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Performing Solvent Flatten of Reference " << t;
+        }
 
-            if (_para.mode == MODE_2D)
-            {
-                REPORT_ERROR("2D MODE DO NOT SUPPORTS PROVIDED MASK");
-
-                abort();
-            }
-            else if (_para.mode == MODE_3D)
-            {
+#ifdef OPTIMISER_SOLVENT_FLATTEN_MASK_ZERO
+        softMask(_model.ref(t), _model.ref(t), weight, 0, _para.nThreadsPerProcess);
+#else
+        softMask(_model.ref(t), _model.ref(t), weight, _para.nThreadsPerProcess);
+#endif
+
+        ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Fourier Transforming Reference " << t;
+        BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Fourier Transforming Reference " << t;
+
+        _fftRef.fwExecutePlan(_model.ref(t));
+    }
+}
+
+const Volume& Optimiser::solventWeight(const bool mask)
+{
+    if (mask)
+    {
 #ifdef OPTIMISER_SOLVENT_FLATTEN_LOW_PASS_MASK
+        if ((_solventWeightKind == SOLVENT_WEIGHT_MASK) &&
+            (_solventWeightR == _r))
+            return _solventWeight;
 
-                fft.fw(_mask, _para.nThreadsPerProcess);
-                // _mask.clearRL();
+        ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Low Pass Filtering Mask";
+        BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Low Pass Filtering Mask";
 
-                Volume lowPassMask(_para.size, _para.size, _para.size, FT_SPACE);
+        _solventWeight.alloc(_para.size, _para.size, _para.size, RL_SPACE);
 
-                lowPassFilter(lowPassMask,
-                              _mask,
-                              (RFLOAT)_r / _para.size,
-                              (RFLOAT)EDGE_WIDTH_FT / _para.size,
-                              _para.nThreadsPerProcess);
+        #pragma omp parallel for num_threads(_para.nThreadsPerProcess)
+        COPY_RL(_solventWeight, _mask);
 
-                fft.bw(lowPassMask, _para.nThreadsPerProcess);
+        _fftRef.fwExecutePlan(_solventWeight);
 
-                fft.bw(_mask, _para.nThreadsPerProcess);
+        lowPassFilter(_solventWeight,
+                      _solventWeight,
+                      (RFLOAT)_r / _para.size,
+                      (RFLOAT)EDGE_WIDTH_FT / _para.size,
+                      _para.nThreadsPerProcess);
 
-#ifdef OPTIMISER_SOLVENT_FLATTEN_MASK_ZERO
-                softMask(_model.ref(t), _model.ref(t), lowPassMask, 0, _para.nThreadsPerProcess);
-#else
-                softMask(_model.ref(t), _model.ref(t), lowPassMask, _para.nThreadsPerProcess);
-#endif
+        _fftRef.bwExecutePlan(_solventWeight, _para.nThreadsPerProcess);
 
-#else
+        _solventWeightKind = SOLVENT_WEIGHT_MASK;
+        _solventWeightR = _r;
 
-#ifdef OPTIMISER_SOLVENT_FLATTEN_MASK_ZERO
-                softMask(_model.ref(t), _model.ref(t), _mask, 0, _para.nThreadsPerProcess);
+        return _solventWeight;
 #else
-                softMask(_model.ref(t), _model.ref(t), _mask, _para.nThreadsPerProcess);
+        return _mask;
 #endif
+    }
 
-#endif
-            }
-            else
-            {
-                REPORT_ERROR("INEXISTENT MODE");
+    if (_solventWeightKind == SOLVENT_WEIGHT_SPHERE)
+        return _solventWeight;
 
-                abort();
-            }
-        }
-        else
-        {
-            ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Performing Solvent Flatten of Reference " << t;
-            BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Performing Solvent Flatten of Reference " << t;
+    ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Generating Spherical Soft Mask";
+    BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Generating Spherical Soft Mask";
 
-            if (_para.mode == MODE_2D)
-            {
-                Image ref(_para.size,
-                          _para.size,
-                          RL_SPACE);
+    if (_para.mode == MODE_2D)
+    {
+        Image circ(_para.size, _para.size, RL_SPACE);
 
-                SLC_EXTRACT_RL(ref, _model.ref(t), 0);
+        softMask(circ,
+                 _para.maskRadius / _para.pixelSize,
+                 EDGE_WIDTH_RL,
+                 _para.nThreadsPerProcess);
 
-#ifdef OPTIMISER_SOLVENT_FLATTEN_MASK_ZERO
-                softMask(ref,
-                         ref,
-                         _para.maskRadius / _para.pixelSize,
-                         EDGE_WIDTH_RL,
-                         0,
-                         _para.nThreadsPerProcess);
-#else
-                softMask(ref,
-                         ref,
-                         _para.maskRadius / _para.pixelSize,
-                         EDGE_WIDTH_RL,
-                         _para.nThreadsPerProcess);
-#endif
+        _solventWeight.alloc(_para.size, _para.size, 1, RL_SPACE);
 
-                COPY_RL(_model.ref(t), ref);
-            }
-            else if (_para.mode == MODE_3D)
-            {
-#ifdef OPTIMISER_SOLVENT_FLATTEN_MASK_ZERO
-                softMask(_model.ref(t),
-                         _model.ref(t),
-                         _para.maskRadius / _para.pixelSize,
-                         EDGE_WIDTH_RL,
-                         0,
-                         _para.nThreadsPerProcess);
-#else
-                softMask(_model.ref(t),
-                         _model.ref(t),
-                         _para.maskRadius / _para.pixelSize,
-                         EDGE_WIDTH_RL,
-                         _para.nThreadsPerProcess);
-#endif
-            }
-            else
-            {
-                REPORT_ERROR("INEXISTENT MODE");
-
-                abort();
-            }
-        }
+        #pragma omp parallel for num_threads(_para.nThreadsPerProcess)
+        COPY_RL(_solventWeight, circ);
+    }
+    else if (_para.mode == MODE_3D)
+    {
+        _solventWeight.alloc(_para.size, _para.size, _para.size, RL_SPACE);
 
-        ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Fourier Transforming Reference " << t;
-        BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Fourier Transforming Reference " << t;
+        softMask(_solventWeight,
+                 _para.maskRadius / _para.pixelSize,
+                 EDGE_WIDTH_RL,
+                 _para.nThreadsPerProcess);
+    }
+    else
+    {
+        REPORT_ERROR("INEXISTENT MODE");
 
-        fft.fw(_model.ref(t), _para.nThreadsPerProcess);
-        // _model.ref(t).clearRL();
+        abort();
     }
+
+    _solventWeightKind = SOLVENT_WEIGHT_SPHERE;
+
+    return _solventWeight;
 }
 
 void Optimiser::allocPreCalIdx(const RFLOAT rU,
@@ -8038,6 +8718,13 @@ void Optimiser::allocPreCalIdx(const RFLOAT rU,
             }
         }
     }
+
+    _ctfGeom.init(_para.pixelSize,
+                  _para.size,
+                  _para.size,
+                  _iCol,
+                  _iRow,
+                  _nPxl);
 }
 
 void Optimiser::allocPreCal(const bool mask,
@@ -8073,53 +8760,85 @@ void Optimiser::allocPreCal(const bool mask,
 
     if (!ctf)
     {
-        _ctfP = (RFLOAT*)TSFFTW_malloc(_ID.size() * _nPxl * sizeof(RFLOAT));
+        // images sharing the same CTF attributes, such as those of a micrograph, share one CTF evaluation
+        typedef std::map<CTFAttr, vector<int>, bool(*)(const CTFAttr&, const CTFAttr&)> CTFGroup;
 
-#ifdef OPTIMISER_CTF_ON_THE_FLY
-        RFLOAT* poolCTF = (RFLOAT*)TSFFTW_malloc(_nPxl * omp_get_max_threads() * sizeof(RFLOAT));
-#endif
+        CTFGroup group(ctfAttrLess);
 
-        #pragma omp parallel for
         FOR_EACH_2D_IMAGE
-        {
-#ifdef OPTIMISER_CTF_ON_THE_FLY
-            RFLOAT* ctf = poolCTF + _nPxl * omp_get_thread_num();
+            group[_ctfAttr[l]].push_back(l);
 
-            CTF(ctf,
-                _para.pixelSize,
-                _ctfAttr[l].voltage,
-                _ctfAttr[l].defocusU,
-                _ctfAttr[l].defocusV,
-                _ctfAttr[l].defocusTheta,
-                _ctfAttr[l].Cs,
-                _ctfAttr[l].amplitudeContrast,
-                _ctfAttr[l].phaseShift,
-                _para.size,
-                _para.size,
-                _iCol,
-                _iRow,
-                _nPxl,
-                1);
+        vector<const vector<int>*> member;
 
-            for (int i = 0; i < _nPxl; i++)
+        for (CTFGroup::const_iterator it = group.begin(); it != group.end(); it++)
+            member.push_back(&it->second);
+
+        // in image-major order, the CPU path stores one CTF per group; the
+        // pixel-major order and the GPU kernels need one CTF per image
+#ifdef GPU_VERSION
+        bool share = false;
+#else
+        bool share = !pixelMajor;
+#endif
+
+        _iCtfP = new int[_ID.size()];
+
+        for (int g = 0; g < (int)member.size(); g++)
+            for (size_t m = 0; m < member[g]->size(); m++)
             {
-                _ctfP[pixelMajor
-                    ? (i * _ID.size() + l)
-                    : (_nPxl * l + i)] = ctf[i];
+                int l = (*member[g])[m];
+
+                _iCtfP[l] = share ? g : l;
             }
+
+        size_t nCtf = share ? member.size() : _ID.size();
+
+        _ctfP = (RFLOAT*)TSFFTW_malloc(nCtf * _nPxl * sizeof(RFLOAT));
+
+        RFLOAT* poolCTF = (RFLOAT*)TSFFTW_malloc(_nPxl * omp_get_max_threads() * sizeof(RFLOAT));
+
+        #pragma omp parallel for schedule(dynamic)
+        for (int g = 0; g < (int)member.size(); g++)
+        {
+            RFLOAT* ctf = share
+                        ? _ctfP + _nPxl * g
+                        : poolCTF + _nPxl * omp_get_thread_num();
+
+#ifdef OPTIMISER_CTF_ON_THE_FLY
+            const CTFAttr& attr = _ctfAttr[(*member[g])[0]];
+
+            CTF(ctf,
+                _ctfGeom,
+                attr.voltage,
+                attr.defocusU,
+                attr.defocusV,
+                attr.defocusTheta,
+                attr.Cs,
+                attr.amplitudeContrast,
+                attr.phaseShift);
 #else
+            const Image& ctfImg = _ctf[(*member[g])[0]];
+
             for (int i = 0; i < _nPxl; i++)
+                ctf[i] = REAL(ctfImg.iGetFT(_iPxl[i]));
+#endif
+
+            if (share) continue;
+
+            for (size_t m = 0; m < member[g]->size(); m++)
             {
-                _ctfP[pixelMajor
-                    ? (i * _ID.size() + l)
-                    : (_nPxl * l + i)] = REAL(_ctf[l].iGetFT(_iPxl[i]));
+                int l = (*member[g])[m];
+
+                for (int i = 0; i < _nPxl; i++)
+                {
+                    _ctfP[pixelMajor
+                        ? (i * _ID.size() + l)
+                        : (_nPxl * l + i)] = ctf[i];
+                }
             }
-#endif
         }
 
-#ifdef OPTIMISER_CTF_ON_THE_FLY
         TSFFTW_free(poolCTF);
-#endif
     }
     else
     {
@@ -8181,6 +8900,8 @@ void Optimiser::freePreCalIdx()
 
     delete[] _iColPad;
     delete[] _iRowPad;
+
+    _ctfGeom.clear();
 }
 
 void Optimiser::freePreCal(const bool ctf)
@@ -8200,6 +8921,9 @@ void Optimiser::freePreCal(const bool ctf)
     if (!ctf)
     {
         TSFFTW_free(_ctfP);
+
+        delete[] _iCtfP;
+        _iCtfP = NULL;
     }
     else
     {
@@ -8419,6 +9143,14 @@ void Optimiser::saveSubtract()
 {
     IF_MASTER return;
 
+    if (_para.mode == MODE_2D)
+    {
+        ALOG(FATAL, "LOGGER_ROUND") << "Round " << _iter << ", " << "SAVE SUBTRACT DOES NOT SUPPORT 2D MODE";
+        BLOG(FATAL, "LOGGER_ROUND") << "Round " << _iter << ", " << "SAVE SUBTRACT DOES NOT SUPPORT 2D MODE";
+
+        abort();
+    }
+
     ALOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving Masked Region Reference Subtracted Images";
     BLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving Masked Region Reference Subtracted Images";
 
@@ -8426,104 +9158,111 @@ void Optimiser::saveSubtract()
 
     sprintf(filename, "%sSubtract_Rank_%06d.mrcs", _para.dstPrefix, _commRank);
 
+    int nCopy = 1 + _sym.nSymmetryElement();
+
     ImageFile imf;
 
-    imf.openStack(filename, _para.size, _ID.size() * (1 + _sym.nSymmetryElement()), _para.pixelSize);
+    imf.openStack(filename, _para.size, _ID.size() * nCopy, _para.pixelSize);
 
-    Image result(_para.size, _para.size, FT_SPACE);
-    Image diff(_para.size, _para.size, FT_SPACE);
+    // a single-threaded plan, executed by all threads at a time
+    FFT fft;
 
-    size_t cls;
-    dmat33 rotB; // rot for base left closet
-    dmat33 rotC; // rot for every left closet
-    dvec2 tran;
-    double d;
+    fft.bwCreatePlan(_para.size, _para.size, 1);
 
-    FOR_EACH_2D_IMAGE
-    {
-        if (_para.mode == MODE_2D)
-        {
-            ALOG(FATAL, "LOGGER_ROUND") << "Round " << _iter << ", " << "SAVE SUBTRACT DOES NOT SUPPORT 2D MODE";
-            BLOG(FATAL, "LOGGER_ROUND") << "Round " << _iter << ", " << "SAVE SUBTRACT DOES NOT SUPPORT 2D MODE";
+    unsigned int nThread = _para.nThreadsPerProcess;
 
-            abort();
-        }
+    {
+        StackWriter writer(imf, SUBTRACT_N_SLOT_PER_THREAD * nThread, _para.size);
 
-        _par[l].rank1st(cls, rotB, tran, d);
+        #pragma omp parallel num_threads(nThread)
+        {
+            Image result(_para.size, _para.size, FT_SPACE);
+            Image diff(_para.size, _para.size, FT_SPACE);
 
 #ifdef OPTIMISER_CTF_ON_THE_FLY
+            Image ctf(_para.size, _para.size, FT_SPACE);
+#endif
 
-        Image ctf(_para.size, _para.size, FT_SPACE);
-        CTF(ctf,
-            _para.pixelSize,
-            _ctfAttr[l].voltage,
-            _ctfAttr[l].defocusU,
-            _ctfAttr[l].defocusV,
-            _ctfAttr[l].defocusTheta,
-            _ctfAttr[l].Cs,
-            _ctfAttr[l].amplitudeContrast,
-            _ctfAttr[l].phaseShift,
-            _para.nThreadsPerProcess);
+            size_t cls;
+            dmat33 rotB; // rot for base left closet
+            dmat33 rotC; // rot for every left closet
+            dvec2 tran;
+            double d;
 
-#endif
+            #pragma omp for schedule(dynamic)
+            FOR_EACH_2D_IMAGE
+            {
+                _par[l].rank1st(cls, rotB, tran, d);
 
-        for (int i = -1; i < _sym.nSymmetryElement(); i++)
-        {
-            #pragma omp parallel for
-            SET_0_FT(result);
+#ifdef OPTIMISER_CTF_ON_THE_FLY
+                CTF(ctf,
+                    _para.pixelSize,
+                    _ctfAttr[l].voltage,
+                    _ctfAttr[l].defocusU,
+                    _ctfAttr[l].defocusV,
+                    _ctfAttr[l].defocusTheta,
+                    _ctfAttr[l].Cs,
+                    _ctfAttr[l].amplitudeContrast,
+                    _ctfAttr[l].phaseShift,
+                    1);
+#endif
 
-            #pragma omp parallel for
-            SET_0_FT(diff);
+                for (int i = -1; i < _sym.nSymmetryElement(); i++)
+                {
+                    SET_0_FT(result);
 
-            if (i == -1)
-            {
-                rotC = rotB;
-            }
-            else
-            {
-                dmat33 L, R;
+                    if (i == -1)
+                    {
+                        rotC = rotB;
+                    }
+                    else
+                    {
+                        dmat33 L, R;
 
-                _sym.get(L, R, i);
-                rotC = R.transpose() * rotB;
-            }
+                        _sym.get(L, R, i);
+                        rotC = R.transpose() * rotB;
+                    }
 
-            _model.proj(cls).project(result, rotC, tran - _offset[l], _para.nThreadsPerProcess);
+                    _model.proj(cls).project(result, rotC, tran - _offset[l], 1);
 
-            #pragma omp parallel for
-            FOR_EACH_PIXEL_FT(diff)
-            {
+                    FOR_EACH_PIXEL_FT(diff)
+                    {
 #ifdef OPTIMISER_CTF_ON_THE_FLY
-                diff[i] = _imgOri[l][i] - result[i] * REAL(ctf[i]);
+                        diff[i] = _imgOri[l][i] - result[i] * REAL(ctf[i]);
 #else
-                diff[i] = _imgOri[l][i] - result[i] * REAL(_ctf[l][i]);
+                        diff[i] = _imgOri[l][i] - result[i] * REAL(_ctf[l][i]);
 #endif
-            }
+                    }
 
-            dvec3 regionTrans = rotC.transpose() * dvec3(_regionCentre(0),
-                                                         _regionCentre(1),
-                                                         _regionCentre(2));
+                    dvec3 regionTrans = rotC.transpose() * dvec3(_regionCentre(0),
+                                                                 _regionCentre(1),
+                                                                 _regionCentre(2));
 
-            translate(diff,
-                      diff,
-                      -tran(0) + _offset[l](0) - regionTrans(0),
-                      -tran(1) + _offset[l](1) - regionTrans(1),
-                      _para.nThreadsPerProcess);
+                    translate(diff,
+                              diff,
+                              -tran(0) + _offset[l](0) - regionTrans(0),
+                              -tran(1) + _offset[l](1) - regionTrans(1),
+                              1);
 
-            if (i == -1)
-            {
-                _par[l].setT(_par[l].t().rowwise() - (tran - _offset[l]).transpose());
-                _par[l].setTopT(_par[l].topT() - tran + _offset[l]);
-                _par[l].setTopTPrev(_par[l].topTPrev() - tran + _offset[l]);
-            }
+                    if (i == -1)
+                    {
+                        _par[l].setT(_par[l].t().rowwise() - (tran - _offset[l]).transpose());
+                        _par[l].setTopT(_par[l].topT() - tran + _offset[l]);
+                        _par[l].setTopTPrev(_par[l].topTPrev() - tran + _offset[l]);
+                    }
 
-            _fftImg.bwExecutePlan(diff, _para.nThreadsPerProcess);
+                    int slot = writer.acquire();
 
-            imf.writeStack(diff, l + _ID.size() * (i + 1));
+                    fft.bwExecutePlan(writer.image(slot), diff);
 
-            _fftImg.fwExecutePlan(diff);
+                    writer.submit(slot, l + _ID.size() * (i + 1));
+                }
+            }
         }
     }
 
+    fft.bwDestroyPlan();
+
     imf.closeStack();
 
 #ifdef VERBOSE_LEVEL_1
@@ -8536,92 +9275,217 @@ void Optimiser::saveSubtract()
     MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving Masked Region Reference Subtracted Image File To Path: " << filename;
 }
 
+struct BMPSaving : public AsyncWriter::Job
+{
+    vector<Image> img;
+
+    vector<string> filename;
+
+    /**
+     * whether saving Fourier space of each image or real space
+     */
+    vector<bool> ft;
+
+    void write()
+    {
+        for (size_t i = 0; i < img.size(); i++)
+        {
+            if (ft[i])
+                img[i].saveFTToBMP(filename[i].c_str(), 0.01);
+            else
+                img[i].saveRLToBMP(filename[i].c_str());
+        }
+    }
+};
+
+bool Optimiser::isSavedImage(const int id) const
+{
+    int stride = GSL_MAX_INT(1, _para.saveImgStride);
+
+    return (id % stride == 0) && (id / stride < N_SAVE_IMG);
+}
+
+void Optimiser::waitSavingBMP()
+{
+    _bmpWriter.wait();
+}
+
 void Optimiser::saveBestProjections()
 {
     IF_MASTER return;
 
-    FFT fft;
+    if ((_para.mode != MODE_2D) &&
+        (_para.mode != MODE_3D))
+    {
+        REPORT_ERROR("INEXISTENT MODE");
 
-    Image result(_para.size, _para.size, FT_SPACE);
-    Image diff(_para.size, _para.size, FT_SPACE);
-    char filename[FILE_NAME_LENGTH];
+        abort();
+    }
 
-    size_t cls;
-    dmat22 rot2D;
-    dmat33 rot3D;
-    dvec2 tran;
-    double d;
+    // the images of the last saving have to be written before reusing the writer
+    waitSavingBMP();
+
+    vector<int> saved;
 
     FOR_EACH_2D_IMAGE
+        if (isSavedImage(_ID[l]))
+            saved.push_back(l);
+
+    if (saved.empty()) return;
+
+    BMPSaving* job = new BMPSaving;
+
+    job->img.resize(2 * saved.size());
+    job->filename.resize(2 * saved.size());
+    job->ft.assign(2 * saved.size(), false);
+
+    char filename[FILE_NAME_LENGTH];
+
+    for (size_t s = 0; s < saved.size(); s++)
     {
-        if (_ID[l] < N_SAVE_IMG)
+        sprintf(filename, "%sResult_%04d_Round_%03d.bmp", _para.dstPrefix, _ID[saved[s]], _iter);
+        job->filename[2 * s] = filename;
+
+        sprintf(filename, "%sDiff_%04d_Round_%03d.bmp", _para.dstPrefix, _ID[saved[s]], _iter);
+        job->filename[2 * s + 1] = filename;
+    }
+
+    // a single-threaded plan, executed by all threads at a time
+    FFT fft;
+
+    fft.bwCreatePlan(_para.size, _para.size, 1);
+
+    #pragma omp parallel num_threads(_para.nThreadsPerProcess)
+    {
+        Image result(_para.size, _para.size, FT_SPACE);
+        Image diff(_para.size, _para.size, FT_SPACE);
+
+#ifdef OPTIMISER_CTF_ON_THE_FLY
+        Image ctf(_para.size, _para.size, FT_SPACE);
+#endif
+
+        size_t cls;
+        dmat22 rot2D;
+        dmat33 rot3D;
+        dvec2 tran;
+        double d;
+
+        #pragma omp for schedule(dynamic)
+        for (ptrdiff_t s = 0; s < static_cast<ptrdiff_t>(saved.size()); s++)
         {
-            #pragma omp parallel for
-            SET_0_FT(result);
+            int l = saved[s];
 
-            #pragma omp parallel for
-            SET_0_FT(diff);
+            SET_0_FT(result);
 
             if (_para.mode == MODE_2D)
             {
                 _par[l].rank1st(cls, rot2D, tran, d);
 
-                _model.proj(cls).project(result, rot2D, tran, _para.nThreadsPerProcess);
+                _model.proj(cls).project(result, rot2D, tran, 1);
             }
-            else if (_para.mode == MODE_3D)
+            else
             {
                 _par[l].rank1st(cls, rot3D, tran, d);
 
-                _model.proj(cls).project(result, rot3D, tran, _para.nThreadsPerProcess);
+                _model.proj(cls).project(result, rot3D, tran, 1);
             }
-            else
-                REPORT_ERROR("INEXISTENT MODE");
-
-            sprintf(filename, "%sResult_%04d_Round_%03d.bmp", _para.dstPrefix, _ID[l], _iter);
-
-            fft.bw(result, _para.nThreadsPerProcess);
-            result.saveRLToBMP(filename);
-            MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving Result Round BMP File To Path: " << filename;
-            fft.fw(result, _para.nThreadsPerProcess);
 
 #ifdef OPTIMISER_CTF_ON_THE_FLY
-            // TODO
+            CTF(ctf,
+                _para.pixelSize,
+                _ctfAttr[l].voltage,
+                _ctfAttr[l].defocusU,
+                _ctfAttr[l].defocusV,
+                _ctfAttr[l].defocusTheta,
+                _ctfAttr[l].Cs,
+                _ctfAttr[l].amplitudeContrast,
+                _ctfAttr[l].phaseShift,
+                1);
+
+            FOR_EACH_PIXEL_FT(diff)
+                diff[i] = _img[l][i] - result[i] * REAL(ctf[i]);
 #else
-            #pragma omp parallel for
             FOR_EACH_PIXEL_FT(diff)
                 diff[i] = _img[l][i] - result[i] * REAL(_ctf[l][i]);
 #endif
 
-            sprintf(filename, "%sDiff_%04d_Round_%03d.bmp", _para.dstPrefix, _ID[l], _iter);
-            fft.bw(diff, _para.nThreadsPerProcess);
-            diff.saveRLToBMP(filename);
-            MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving Diff Round BMP File To Path: " << filename;
-            fft.fw(diff, _para.nThreadsPerProcess);
+            // the inverse Fourier transform overwrites its source, so the difference is calculated first
+            job->img[2 * s].alloc(_para.size, _para.size, RL_SPACE);
+            fft.bwExecutePlan(job->img[2 * s], result);
+
+            job->img[2 * s + 1].alloc(_para.size, _para.size, RL_SPACE);
+            fft.bwExecutePlan(job->img[2 * s + 1], diff);
         }
     }
 
+    fft.bwDestroyPlan();
+
+    for (size_t i = 0; i < job->filename.size(); i++)
+        MLOG(INFO, "LOGGER_ROUND") << "Round " << _iter << ", " << "Saving BMP File To Path: " << job->filename[i];
+
+    _bmpWriter.submit(job);
 }
 
 void Optimiser::saveImages()
 {
     IF_MASTER return;
 
-    char filename[FILE_NAME_LENGTH];
+    waitSavingBMP();
+
+    vector<int> saved;
+
     FOR_EACH_2D_IMAGE
+        if (isSavedImage(_ID[l]))
+            saved.push_back(l);
+
+    if (saved.empty()) return;
+
+    BMPSaving* job = new BMPSaving;
+
+    job->img.resize(2 * saved.size());
+    job->filename.resize(2 * saved.size());
+    job->ft.resize(2 * saved.size());
+
+    char filename[FILE_NAME_LENGTH];
+
+    for (size_t s = 0; s < saved.size(); s++)
     {
-        if (_ID[l] < N_SAVE_IMG)
+        sprintf(filename, "Fourier_Image_%04d.bmp", _ID[saved[s]]);
+        job->filename[2 * s] = filename;
+        job->ft[2 * s] = true;
+
+        sprintf(filename, "Image_%04d.bmp", _ID[saved[s]]);
+        job->filename[2 * s + 1] = filename;
+        job->ft[2 * s + 1] = false;
+    }
+
+    FFT fft;
+
+    fft.bwCreatePlan(_para.size, _para.size, 1);
+
+    #pragma omp parallel num_threads(_para.nThreadsPerProcess)
+    {
+        Image img(_para.size, _para.size, FT_SPACE);
+
+        #pragma omp for schedule(dynamic)
+        for (ptrdiff_t s = 0; s < static_cast<ptrdiff_t>(saved.size()); s++)
         {
-            sprintf(filename, "Fourier_Image_%04d.bmp", _ID[l]);
+            int l = saved[s];
 
-            _imgOri[l].saveFTToBMP(filename, 0.01);
+            job->img[2 * s].alloc(_para.size, _para.size, FT_SPACE);
+            COPY_FT(job->img[2 * s], _imgOri[l]);
 
-            sprintf(filename, "Image_%04d.bmp", _ID[l]);
+            // transform a copy, leaving the image untouched
+            COPY_FT(img, _imgOri[l]);
 
-            _fftImg.bwExecutePlan(_imgOri[l], _para.nThreadsPerProcess);
-            _imgOri[l].saveRLToBMP(filename);
-            _fftImg.fwExecutePlan(_imgOri[l]);
+            job->img[2 * s + 1].alloc(_para.size, _para.size, RL_SPACE);
+            fft.bwExecutePlan(job->img[2 * s + 1], img);
         }
     }
+
+    fft.bwDestroyPlan();
+
+    _bmpWriter.submit(job);
 }
 
 void Optimiser::saveCTFs()
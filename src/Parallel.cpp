@@ -9,6 +9,7 @@
 #include "Parallel.h"
 
 #include <exception>
+#include <unistd.h>
 
 Parallel::Parallel() {}
 
@@ -247,6 +248,25 @@ void MPI_Ssend_Large(const void* buf,
     }
 }
 
+void MPI_Barrier_Lazy(MPI_Comm comm,
+                      const int interval)
+{
+    MPI_Request request;
+
+    MPI_Ibarrier(comm, &request);
+
+    int flag = 0;
+
+    MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
+
+    while (!flag)
+    {
+        usleep(interval);
+
+        MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
+    }
+}
+
 void MPI_Bcast_Large(void* buf,
                      size_t count,
                      MPI_Datatype datatype,
@@ -345,3 +365,62 @@ void MPI_Allreduce_Large(void* buf,
         ptr += MPI_MAX_BUF;
     }
 }
+
+static void MPI_Iallreduce_Large_Next(MPI_Request_Large& request)
+{
+    int blockSize = (request.nLeft > (size_t)request.chunk)
+                  ? request.chunk
+                  : (int)request.nLeft;
+
+    MPI_Request chunk;
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   request.ptr,
+                   blockSize,
+                   request.datatype,
+                   request.op,
+                   request.comm,
+                   &chunk);
+
+    request.requests.push_back(chunk);
+
+    request.ptr += (size_t)blockSize * request.dataTypeSize;
+    request.nLeft -= blockSize;
+}
+
+void MPI_Iallreduce_Large(void* buf,
+                          size_t count,
+                          MPI_Datatype datatype,
+                          MPI_Op op,
+                          MPI_Comm comm,
+                          MPI_Request_Large& request)
+{
+    MPI_Type_size(datatype, &request.dataTypeSize);
+
+    request.ptr = static_cast<char*>(buf);
+    request.nLeft = count;
+    request.chunk = MPI_PIPELINE_BUF / request.dataTypeSize;
+    request.datatype = datatype;
+    request.op = op;
+    request.comm = comm;
+
+    request.requests.clear();
+
+    while ((request.nLeft > 0) &&
+           (request.requests.size() < MPI_PIPELINE_N_IN_FLIGHT))
+        MPI_Iallreduce_Large_Next(request);
+}
+
+void MPI_Wait_Large(MPI_Request_Large& request)
+{
+    while (!request.requests.empty())
+    {
+        MPI_Wait(&request.requests.front(), MPI_STATUS_IGNORE);
+
+        request.requests.pop_front();
+
+        // the chunks are started in a fixed order, the same in all processes
+        if (request.nLeft > 0)
+            MPI_Iallreduce_Large_Next(request);
+    }
+}
@@ -288,8 +288,9 @@ void Particle::initD(const int nD,
     _d.resize(nD);
 
 #ifdef PARTICLE_DEFOCUS_INIT_GAUSSIAN
-    for (int i = 0; i < _nD; i++)
-        _d(i) = 1 + gsl_ran_gaussian(engine, sD);
+    random_gaussian_batch(_d.data(), _nD, sD, engine);
+
+    _d.array() += 1;
 #endif
 
 #ifdef PARTICLE_DEFOCUS_INIT_FLAT
@@ -536,13 +537,12 @@ void Particle::load(const int nR,
     _topDPrev = d;
     _topD = d;
 
-    for (int i = 0; i < _nD; i++)
-    {
-        _d(i) = d + gsl_ran_gaussian(engine, _s);
+    random_gaussian_batch(_d.data(), _nD, _s, engine);
 
-        _wD(i) = 1.0 / _nD;
-        _uD(i) = 1.0 / _nD;
-    }
+    _d.array() += d;
+
+    _wD = dvec::Constant(_nD, 1.0 / _nD);
+    _uD = dvec::Constant(_nD, 1.0 / _nD);
 
 #ifdef PARTICLE_BALANCE_WEIGHT_D
     balanceWeight(PAR_D);
@@ -1025,8 +1025,6 @@ void Particle::calVari(const ParticleType pt)
 
             dvec4 mean;
 
-            dvec4 quat;
-
             gsl_rng* engine = get_random_engine();
 
             dvec4 anch = _r.row(gsl_rng_uniform_int(engine, _nR)).transpose();
@@ -1051,14 +1049,7 @@ void Particle::calVari(const ParticleType pt)
 
             inferACG(mean, _r);
 
-            for (int i = 0; i < _nR; i++)
-            {
-                quat = _r.row(i).transpose();
-
-                quaternion_mul(quat, quaternion_conj(mean), quat);
-
-                _r.row(i) = quat.transpose();
-            }
+            quaternion_mul(_r, quaternion_conj(mean), _r);
 
 #endif
 
@@ -1066,14 +1057,7 @@ void Particle::calVari(const ParticleType pt)
 
 #ifdef PARTICLE_ROT_MEAN_USING_STAT_CAL_VARI
 
-            for (int i = 0; i < _nR; i++)
-            {
-                quat = _r.row(i).transpose();
-
-                quaternion_mul(quat, mean, quat);
-
-                _r.row(i) = quat.transpose();
-            }
+            quaternion_mul(_r, mean, _r);
 
 #endif
 
@@ -1161,16 +1145,7 @@ void Particle::perturb(const double pf,
         {
             sampleVMS(d, dvec4(1, 0, 0, 0), GSL_MIN_DBL(PERTURB_K_MAX, _k1 * pf), _nR);
 
-            dvec4 quat;
-
-            for (int i = 0; i < _nR; i++)
-            {
-                quat = _r.row(i).transpose();
-
-                quaternion_mul(quat, quat, d.row(i).transpose());
-
-                _r.row(i) = quat.transpose();
-            }
+            quaternion_mul(_r, _r, d);
 
 #ifdef PARTICLE_BALANCE_WEIGHT_R
         balanceWeight(PAR_R);
@@ -1201,35 +1176,11 @@ void Particle::perturb(const double pf,
             mean = _topR;
 #endif
 
-            dvec4 quat;
-
-            for (int i = 0; i < _nR; i++)
-            {
-                quat = _r.row(i).transpose();
-
-                quaternion_mul(quat, quaternion_conj(mean), quat);
-
-                _r.row(i) = quat.transpose();
-            }
-
-            dvec4 pert;
-
-            for (int i = 0; i < _nR; i++)
-            {
-                quat = _r.row(i).transpose();
-                pert = d.row(i).transpose();
-                quaternion_mul(quat, pert, quat);
-                _r.row(i) = quat.transpose();
-            }
-
-            for (int i = 0; i < _nR; i++)
-            {
-                quat = _r.row(i).transpose();
-
-                quaternion_mul(quat, mean, quat);
-
-                _r.row(i) = quat.transpose();
-            }
+            // move the support points to the origin, perturb them and move
+            // them back, with each step performed on the whole table
+            quaternion_mul(_r, quaternion_conj(mean), _r);
+            quaternion_mul(_r, d, _r);
+            quaternion_mul(_r, mean, _r);
 
             symmetrise(&mean);
         }
@@ -1279,8 +1230,11 @@ void Particle::perturb(const double pf,
     {
         gsl_rng* engine = get_random_engine();
 
-        for (int i = 0; i < _nD; i++)
-            _d(i) += gsl_ran_gaussian(engine, _s) * pf;
+        dvec g(_nD);
+
+        random_gaussian_batch(g.data(), _nD, _s * pf, engine);
+
+        _d += g;
 
 #ifdef PARTICLE_BALANCE_WEIGHT_D
         balanceWeight(PAR_D);
@@ -1288,11 +1242,45 @@ void Particle::perturb(const double pf,
     }
 }
 
+// systematic resampling of the support points, with weights w multiplied by
+// likelihood u, using a single uniform draw for all n new support points
+static void systematicResample(uvec& src,
+                               dvec& w,
+                               const dvec& u,
+                               const int n,
+                               gsl_rng* engine)
+{
+    w = w.cwiseProduct(u);
+
+    w /= w.sum();
+
+    dvec cdf = d_cumsum(w);
+
+    cdf /= cdf(cdf.size() - 1);
+
+    src.resize(n);
+
+    double u0 = gsl_ran_flat(engine, 0, 1.0 / n);
+
+    int i = 0;
+    for (int j = 0; j < n; j++)
+    {
+        double uj = u0 + j * 1.0 / n;
+
+        while (uj > cdf[i])
+            i++;
+
+        src(j) = i;
+    }
+}
+
 void Particle::resample(const int n,
                         const ParticleType pt)
 {
     gsl_rng* engine = get_random_engine();
 
+    uvec src;
+
     if (pt == PAR_C)
     {
         shuffle(pt);
@@ -1301,34 +1289,19 @@ void Particle::resample(const int n,
 
         c(_topC, maxIdx);
 
-        for (int i = 0; i < _nC; i++)
-            _wC(i) *= _uC(i);
-
-        _wC /= _wC.sum();
-
-        dvec cdf = d_cumsum(_wC);
-
-        cdf /= cdf(_nC - 1);
+        systematicResample(src, _wC, _uC, n, engine);
 
         _nC = n;
         _wC.resize(_nC);
 
         uvec c(_nC);
 
-        double u0 = gsl_ran_flat(engine, 0, 1.0 / _nC);
-
-        int i = 0;
         for (int j = 0; j < _nC; j++)
         {
-            double uj = u0 + j * 1.0 / _nC;
-
-            while (uj > cdf[i])
-                i++;
-
-            c(j) = _c(i);
+            c(j) = _c(src(j));
 
 #ifdef PARTICLE_PRIOR_ONE
-            _wC(j) = 1.0 / _uC(i);
+            _wC(j) = 1.0 / _uC(src(j));
 #else
             _wC(j) = 1.0 / _nC;
 #endif
@@ -1346,34 +1319,19 @@ void Particle::resample(const int n,
 
         quaternion(_topR, maxIdx);
 
-        for (int i = 0; i < _nR; i++)
-            _wR(i) *= _uR(i);
-
-        _wR /= _wR.sum();
-
-        dvec cdf = d_cumsum(_wR);
-
-        cdf /= cdf(_nR - 1);
+        systematicResample(src, _wR, _uR, n, engine);
 
         _nR = n;
         _wR.resize(_nR);
 
         dmat4 r(_nR, 4);
 
-        double u0 = gsl_ran_flat(engine, 0, 1.0 / _nR);
-
-        int i = 0;
         for (int j = 0; j < _nR; j++)
         {
-            double uj = u0 + j * 1.0 / _nR;
-
-            while (uj > cdf[i])
-                i++;
-
-            r.row(j) = _r.row(i);
+            r.row(j) = _r.row(src(j));
 
 #ifdef PARTICLE_PRIOR_ONE
-            _wR(j) = 1.0 / _uR(i);
+            _wR(j) = 1.0 / _uR(src(j));
 #else
             _wR(j) = 1.0 / _nR;
 #endif
@@ -1391,34 +1349,19 @@ void Particle::resample(const int n,
 
         t(_topT, maxIdx);
 
-        for (int i = 0; i < _nT; i++)
-            _wT(i) *= _uT(i);
-
-        _wT /= _wT.sum();
-
-        dvec cdf = d_cumsum(_wT);
-
-        cdf /= cdf(_nT - 1);
+        systematicResample(src, _wT, _uT, n, engine);
 
         _nT = n;
         _wT.resize(_nT);
 
         dmat2 t(_nT, 2);
 
-        double u0 = gsl_ran_flat(engine, 0, 1.0 / _nT);
-
-        int i = 0;
         for (int j = 0; j < _nT; j++)
         {
-            double uj = u0 + j * 1.0 / _nT;
-
-            while (uj > cdf[i])
-                i++;
-
-            t.row(j) = _t.row(i);
+            t.row(j) = _t.row(src(j));
 
 #ifdef PARTICLE_PRIOR_ONE
-            _wT(j) = 1.0 / _uT(i);
+            _wT(j) = 1.0 / _uT(src(j));
 #else
             _wT(j) = 1.0 / _nT;
 #endif
@@ -1436,34 +1379,19 @@ void Particle::resample(const int n,
 
         d(_topD, maxIdx);
 
-        for (int i = 0; i < _nD; i++)
-            _wD(i) *= _uD(i);
-
-        _wD /= _wD.sum();
-
-        dvec cdf = d_cumsum(_wD);
-
-        cdf /= cdf(_nD - 1);
+        systematicResample(src, _wD, _uD, n, engine);
 
         _nD = n;
         _wD.resize(_nD);
 
         dvec d(_nD);
 
-        double u0 = gsl_ran_flat(engine, 0, 1.0 / _nD);
-
-        int i = 0;
         for (int j = 0; j < _nD; j++)
         {
-            double uj = u0 + j * 1.0 / _nD;
-
-            while (uj > cdf[i])
-                i++;
-
-            d(j) = _d(i);
+            d(j) = _d(src(j));
 
 #ifdef PARTICLE_PRIOR_ONE
-            _wD(j) = 1.0 / _uD(i);
+            _wD(j) = 1.0 / _uD(src(j));
 #else
             _wD(j) = 1.0 / _nD;
 #endif
@@ -2454,20 +2382,7 @@ void Particle::symmetrise(const dvec4* anchor)
     inferACG(mean, _r);
     ***/
 
-    dvec4 quat;
-
-    for (int i = 0; i < _nR; i++)
-    {
-        dvec4 quat = _r.row(i).transpose();
-
-        // quaternion_mul(quat, quaternion_conj(mean), quat);
-
-        symmetryCounterpart(quat, *_sym, anchor);
-
-        // quaternion_mul(quat, mean, quat);
-
-        _r.row(i) = quat.transpose();
-    }
+    symmetryCounterpart(_r, *_sym, anchor);
 }
 
 void Particle::reCentre()
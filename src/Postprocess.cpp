@@ -60,16 +60,27 @@ void Postprocess::run(const unsigned int nThread)
 
     maskAB(nThread);
 
-    imf.readMetaData(_mapAMasked);
-    imf.writeVolume("Reference_A_Masked.mrc", _mapA);
-    imf.readMetaData(_mapBMasked);
-    imf.writeVolume("Reference_B_Masked.mrc", _mapB);
+    CLOG(INFO, "LOGGER_SYS") << "Averaging Reference A and B";
+
+    _mapI.alloc(_size, _size, _size, RL_SPACE);
+
+    averageAB(nThread);
+
+    // written while the half maps are transformed
+    writeVolumeAsync("Reference_A_Masked.mrc", _mapAMasked);
+    writeVolumeAsync("Reference_B_Masked.mrc", _mapBMasked);
+    writeVolumeAsync("Reference_Average.mrc", _mapI);
 
     CLOG(INFO, "LOGGER_SYS") << "Performing Fourier Transform";
 
     fft.fw(_mapA, nThread);
     fft.fw(_mapB, nThread);
 
+    waitWriting();
+
+    // the transform of the average is the average of the transforms
+    _mapI.clear();
+
     fft.fw(_mapAMasked, nThread);
     fft.fw(_mapBMasked, nThread);
 
@@ -79,9 +90,10 @@ void Postprocess::run(const unsigned int nThread)
 
     _FSCMask.resize(maxR());
 
-    FSC(_FSCUnmask, _mapA, _mapB, nThread);
+    FSC(_FSCUnmask, _FSCMask, _mapA, _mapB, _mapAMasked, _mapBMasked, nThread);
 
-    FSC(_FSCMask, _mapAMasked, _mapBMasked, nThread);
+    _mapAMasked.clear();
+    _mapBMasked.clear();
 
     int randomPhaseThres = resP(_FSCUnmask, 0.8, 1, 1, false);
 
@@ -106,6 +118,9 @@ void Postprocess::run(const unsigned int nThread)
 
     FSC(_FSCRFMask, _mapARFMask, _mapBRFMask, nThread);
 
+    _mapARFMask.clear();
+    _mapBRFMask.clear();
+
     CLOG(INFO, "LOGGER_SYS") << "Calculating True FSC";
 
     _FSC.resize(maxR());
@@ -131,14 +146,10 @@ void Postprocess::run(const unsigned int nThread)
 
     CLOG(INFO, "LOGGER_SYS") << "Merging Two References";
     
-    mergeAB();
+    mergeAB(nThread);
 
-    fft.bw(_mapI, nThread);
-
-    imf.readMetaData(_mapI);
-    imf.writeVolume("Reference_Average.mrc", _mapI, _pixelSize);
-
-    fft.fw(_mapI, nThread);
+    _mapA.clear();
+    _mapB.clear();
 
     CLOG(INFO, "LOGGER_SYS") << "Applying FSC Weighting";
 
@@ -188,6 +199,13 @@ void Postprocess::maskAB(const unsigned int nThread)
     softMask(_mapBMasked, _mapB, _mask, 0, nThread);
 }
 
+void Postprocess::averageAB(const unsigned int nThread)
+{
+    #pragma omp parallel for num_threads(nThread)
+    FOR_EACH_PIXEL_RL(_mapI)
+        _mapI(i) = (_mapA(i) + _mapB(i)) / 2;
+}
+
 void Postprocess::maskABRF(const unsigned int nThread)
 {
     softMask(_mapARFMask, _mapARFMask, _mask, 0, nThread);
@@ -204,10 +222,11 @@ void Postprocess::randomPhaseAB(const int randomPhaseThres,
     randomPhase(_mapBRFMask, _mapB, randomPhaseThres, nThread);
 }
 
-void Postprocess::mergeAB()
+void Postprocess::mergeAB(const unsigned int nThread)
 {
     _mapI.alloc(_size, _size, _size, FT_SPACE);
 
+    #pragma omp parallel for num_threads(nThread)
     FOR_EACH_PIXEL_FT(_mapI)
         _mapI[i] = (_mapA[i] + _mapB[i]) / 2;
 }
@@ -230,3 +249,37 @@ void Postprocess::saveFSC() const
 
     fclose(file);
 }
+
+struct VolumeWriting : public AsyncWriter::Job
+{
+    const Volume* vol;
+
+    std::string filename;
+
+    RFLOAT pixelSize;
+
+    void write()
+    {
+        ImageFile imf;
+
+        imf.readMetaData(*vol);
+        imf.writeVolume(filename.c_str(), *vol, pixelSize);
+    }
+};
+
+void Postprocess::writeVolumeAsync(const char filename[],
+                                   const Volume& vol)
+{
+    VolumeWriting* job = new VolumeWriting;
+
+    job->vol = &vol;
+    job->filename = filename;
+    job->pixelSize = _pixelSize;
+
+    _writer.submit(job);
+}
+
+void Postprocess::waitWriting()
+{
+    _writer.wait();
+}
@@ -147,6 +147,20 @@ void Projector::setProjectee(Volume src, const unsigned int nThread)
     _projectee3D.clearRL();
 }
 
+void Projector::attachProjectee(Complex* data,
+                                const int size)
+{
+    _projectee3D.attachFT(data, size, size, size);
+
+    _maxRadius = floor(size / _pf / 2 - 1);
+}
+
+void Projector::clearProjectee()
+{
+    _projectee2D.clear();
+    _projectee3D.clear();
+}
+
 /*void Projector::project(Image& dst,
                         const dmat22& mat) const
 {
@@ -254,84 +268,149 @@ void Projector::project(Complex* dst,
     }
 }*/
 
-void Projector::project(Image& dst,
-                        const dmat22& mat,
-                        const unsigned int nThread) const
-{
+/**
+ * call the kernel instantiated for the interpolation type and the padding
+ * factor of this projector
+ */
+#define PROJECTOR_DISPATCH(kernel, args) \
+    do \
+    { \
+        if (_interp == NEAREST_INTERP) \
+        { \
+            if (_pf == 1) kernel<NEAREST_INTERP, 1> args; \
+            else if (_pf == 2) kernel<NEAREST_INTERP, 2> args; \
+            else kernel<NEAREST_INTERP, 0> args; \
+        } \
+        else \
+        { \
+            if (_pf == 1) kernel<LINEAR_INTERP, 1> args; \
+            else if (_pf == 2) kernel<LINEAR_INTERP, 2> args; \
+            else kernel<LINEAR_INTERP, 0> args; \
+        } \
+    } while (0)
+
+template <int interp, int pf>
+void Projector::projectKernel(Image& dst,
+                              const dmat22& mat,
+                              const unsigned int nThread) const
+{
+    const int f = (pf > 0) ? pf : _pf;
+
     #pragma omp parallel for schedule(dynamic) num_threads(nThread)
     IMAGE_FOR_PIXEL_R_FT(_maxRadius)
         if (QUAD(i, j) < gsl_pow_2(_maxRadius))
         {
-            dvec2 newCor((double)(i * _pf), (double)(j * _pf));
+            dvec2 newCor((double)(i * f), (double)(j * f));
             dvec2 oldCor = mat * newCor;
 
-            dst.setFT(_projectee2D.getByInterpolationFT(oldCor(0),
-                                                        oldCor(1),
-                                                        _interp),
+            dst.setFT(_projectee2D.getByInterpolationFT<interp>(oldCor(0),
+                                                                oldCor(1)),
                       i,
                       j);
         }
 }
 
-void Projector::project(Image& dst,
-                        const dmat33& mat,
-                        const unsigned int nThread) const
+template <int interp, int pf>
+void Projector::projectKernel(Image& dst,
+                              const dmat33& mat,
+                              const unsigned int nThread) const
 {
+    const int f = (pf > 0) ? pf : _pf;
+
     #pragma omp parallel for schedule(dynamic) num_threads(nThread)
     IMAGE_FOR_PIXEL_R_FT(_maxRadius)
         if (QUAD(i, j) < gsl_pow_2(_maxRadius))
         {
-            dvec3 newCor((double)(i * _pf), (double)(j * _pf), 0);
+            dvec3 newCor((double)(i * f), (double)(j * f), 0);
             dvec3 oldCor = mat * newCor;
 
-            dst.setFT(_projectee3D.getByInterpolationFT(oldCor(0),
-                                                        oldCor(1),
-                                                        oldCor(2),
-                                                        _interp),
+            dst.setFT(_projectee3D.getByInterpolationFT<interp>(oldCor(0),
+                                                                oldCor(1),
+                                                                oldCor(2)),
                       i,
                       j);
         }
 }
 
-void Projector::project(Image& dst,
-                        const dmat22& mat,
-                        const int* iCol,
-                        const int* iRow,
-                        const int* iPxl,
-                        const int nPxl,
-                        const unsigned int nThread) const
+template <int interp, int pf>
+void Projector::projectKernel(Complex* dst,
+                              const dmat22& mat,
+                              const int* iCol,
+                              const int* iRow,
+                              const int* iPxl,
+                              const int nPxl,
+                              const unsigned int nThread) const
 {
+    const int f = (pf > 0) ? pf : _pf;
+
     #pragma omp parallel for num_threads(nThread)
     for (int i = 0; i < nPxl; i++)
     {
-        dvec2 newCor((double)(iCol[i] * _pf), (double)(iRow[i] * _pf));
+        dvec2 newCor((double)(iCol[i] * f), (double)(iRow[i] * f));
         dvec2 oldCor = mat * newCor;
 
-        dst[iPxl[i]] = _projectee2D.getByInterpolationFT(oldCor(0),
-                                                         oldCor(1),
-                                                         _interp);
+        dst[iPxl ? iPxl[i] : i] = _projectee2D.getByInterpolationFT<interp>(oldCor(0),
+                                                                            oldCor(1));
+    }
+}
+
+template <int interp, int pf>
+void Projector::projectKernel(Complex* dst,
+                              const dmat33& mat,
+                              const int* iCol,
+                              const int* iRow,
+                              const int* iPxl,
+                              const int nPxl,
+                              const unsigned int nThread) const
+{
+    const int f = (pf > 0) ? pf : _pf;
+
+    #pragma omp parallel for num_threads(nThread)
+    for (int i = 0; i < nPxl; i++)
+    {
+        dvec3 newCor((double)(iCol[i] * f), (double)(iRow[i] * f), 0);
+        dvec3 oldCor = mat * newCor;
+
+        dst[iPxl ? iPxl[i] : i] = _projectee3D.getByInterpolationFT<interp>(oldCor(0),
+                                                                            oldCor(1),
+                                                                            oldCor(2));
     }
 }
 
+void Projector::project(Image& dst,
+                        const dmat22& mat,
+                        const unsigned int nThread) const
+{
+    PROJECTOR_DISPATCH(projectKernel, (dst, mat, nThread));
+}
+
 void Projector::project(Image& dst,
                         const dmat33& mat,
+                        const unsigned int nThread) const
+{
+    PROJECTOR_DISPATCH(projectKernel, (dst, mat, nThread));
+}
+
+void Projector::project(Image& dst,
+                        const dmat22& mat,
                         const int* iCol,
                         const int* iRow,
                         const int* iPxl,
                         const int nPxl,
                         const unsigned int nThread) const
 {
-    #pragma omp parallel for num_threads(nThread)
-    for (int i = 0; i < nPxl; i++)
-    {
-        dvec3 newCor((double)(iCol[i] * _pf), (double)(iRow[i] * _pf), 0);
-        dvec3 oldCor = mat * newCor;
+    PROJECTOR_DISPATCH(projectKernel, (&dst[0], mat, iCol, iRow, iPxl, nPxl, nThread));
+}
 
-        dst[iPxl[i]] = _projectee3D.getByInterpolationFT(oldCor(0),
-                                                         oldCor(1),
-                                                         oldCor(2),
-                                                         _interp);
-    }
+void Projector::project(Image& dst,
+                        const dmat33& mat,
+                        const int* iCol,
+                        const int* iRow,
+                        const int* iPxl,
+                        const int nPxl,
+                        const unsigned int nThread) const
+{
+    PROJECTOR_DISPATCH(projectKernel, (&dst[0], mat, iCol, iRow, iPxl, nPxl, nThread));
 }
 
 void Projector::project(Complex* dst,
@@ -341,16 +420,7 @@ void Projector::project(Complex* dst,
                         const int nPxl,
                         const unsigned int nThread) const
 {
-    #pragma omp parallel for num_threads(nThread)
-    for (int i = 0; i < nPxl; i++)
-    {
-        dvec2 newCor((double)(iCol[i] * _pf), (double)(iRow[i] * _pf));
-        dvec2 oldCor = mat * newCor;
-
-        dst[i] = _projectee2D.getByInterpolationFT(oldCor(0),
-                                                   oldCor(1),
-                                                   _interp);
-    }
+    PROJECTOR_DISPATCH(projectKernel, (dst, mat, iCol, iRow, NULL, nPxl, nThread));
 }
 
 void Projector::project(Complex* dst,
@@ -360,17 +430,7 @@ void Projector::project(Complex* dst,
                         const int nPxl,
                         const unsigned int nThread) const
 {
-    #pragma omp parallel for num_threads(nThread)
-    for (int i = 0; i < nPxl; i++)
-    {
-        dvec3 newCor((double)(iCol[i] * _pf), (double)(iRow[i] * _pf), 0);
-        dvec3 oldCor = mat * newCor;
-
-        dst[i] = _projectee3D.getByInterpolationFT(oldCor(0),
-                                                   oldCor(1),
-                                                   oldCor(2),
-                                                   _interp);
-    }
+    PROJECTOR_DISPATCH(projectKernel, (dst, mat, iCol, iRow, NULL, nPxl, nThread));
 }
 
 //void Projector::project(Image& dst,
@@ -108,9 +108,9 @@ void Reconstructor::allocSpace(const unsigned int nThread)
         BLOG(INFO, "LOGGER_RECO") << "Allocating Spaces";
 
         _F2D.alloc(PAD_SIZE, PAD_SIZE, FT_SPACE);
-        _W2D.alloc(PAD_SIZE, PAD_SIZE, FT_SPACE);
+        _W2D.alloc(PAD_SIZE, PAD_SIZE, 1);
         _C2D.alloc(PAD_SIZE, PAD_SIZE, FT_SPACE);
-        _T2D.alloc(PAD_SIZE, PAD_SIZE, FT_SPACE);
+        _T2D.alloc(PAD_SIZE, PAD_SIZE, 1);
     }
     else if (_mode == MODE_3D)
     {
@@ -127,9 +127,9 @@ void Reconstructor::allocSpace(const unsigned int nThread)
         BLOG(INFO, "LOGGER_RECO") << "Allocating Spaces";
 
         _F3D.alloc(PAD_SIZE, PAD_SIZE, PAD_SIZE, FT_SPACE);
-        _W3D.alloc(PAD_SIZE, PAD_SIZE, PAD_SIZE, FT_SPACE);
+        _W3D.alloc(PAD_SIZE, PAD_SIZE, PAD_SIZE);
         _C3D.alloc(PAD_SIZE, PAD_SIZE, PAD_SIZE, FT_SPACE);
-        _T3D.alloc(PAD_SIZE, PAD_SIZE, PAD_SIZE, FT_SPACE);
+        _T3D.alloc(PAD_SIZE, PAD_SIZE, PAD_SIZE);
 
     }
     else 
@@ -218,13 +218,15 @@ void Reconstructor::reset(const unsigned int nThread)
         SET_0_FT(_F2D);
 
         #pragma omp parallel for num_threads(nThread)
-        SET_1_FT(_W2D);
+        FOR_EACH_PIXEL_FT(_W2D)
+            _W2D[i] = 1;
 
         #pragma omp parallel for num_threads(nThread)
         SET_0_FT(_C2D);
 
         #pragma omp parallel for num_threads(nThread)
-        SET_0_FT(_T2D);
+        FOR_EACH_PIXEL_FT(_T2D)
+            _T2D[i] = 0;
     }
     else if (_mode == MODE_3D)
     {
@@ -232,13 +234,15 @@ void Reconstructor::reset(const unsigned int nThread)
         SET_0_FT(_F3D);
 
         #pragma omp parallel for num_threads(nThread)
-        SET_1_FT(_W3D);
+        FOR_EACH_PIXEL_FT(_W3D)
+            _W3D[i] = 1;
 
         #pragma omp parallel for num_threads(nThread)
         SET_0_FT(_C3D);
 
         #pragma omp parallel for num_threads(nThread)
-        SET_0_FT(_T3D);
+        FOR_EACH_PIXEL_FT(_T3D)
+            _T3D[i] = 0;
     }
     else
     {
@@ -294,6 +298,26 @@ void Reconstructor::setJoinHalf(const bool joinHalf)
     _joinHalf = joinHalf;
 }
 
+bool Reconstructor::symInsert() const
+{
+    return _symInsert;
+}
+
+void Reconstructor::setSymInsert(const bool symInsert)
+{
+    _symInsert = symInsert;
+}
+
+int Reconstructor::kernelType() const
+{
+    return _kernelType;
+}
+
+void Reconstructor::setKernelType(const int kernelType)
+{
+    _kernelType = kernelType;
+}
+
 void Reconstructor::setSymmetry(const Symmetry* sym)
 {
     _sym = sym;
@@ -421,27 +445,60 @@ void Reconstructor::insertDir(const double ox,
     _counter +=1;
 }
 
-void Reconstructor::insert(const Image& src,
-                           const Image& ctf,
-                           const dmat22& rot,
-                           const RFLOAT w)
+#define RECONSTRUCTOR_DISPATCH(kernel, args) \
+    do \
+    { \
+        if (_kernelType == RECONSTRUCTOR_KERNEL_MKB) \
+            kernel<RECONSTRUCTOR_KERNEL_MKB> args; \
+        else \
+            kernel<RECONSTRUCTOR_KERNEL_TRILINEAR> args; \
+    } while (0)
+
+template <int kernel>
+inline void Reconstructor::addFT2D(const Complex f,
+                                   const RFLOAT t,
+                                   const RFLOAT iCol,
+                                   const RFLOAT iRow)
 {
-#ifdef RECONSTRUCTOR_ASSERT_CHECK
-    IF_MASTER
-        REPORT_ERROR("INSERTING IMAGES INTO RECONSTRUCTOR IN MASTER");
+    if (kernel == RECONSTRUCTOR_KERNEL_MKB)
+        _F2D.addFT(f, iCol, iRow, _pf * _a, _kernelFT);
+    else
+        _F2D.addFT(f, iCol, iRow);
 
-    NT_MODE_2D REPORT_ERROR("WRONG MODE");
+#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
+    if (kernel == RECONSTRUCTOR_KERNEL_MKB)
+        _T2D.addFT(t, iCol, iRow, _pf * _a, _kernelFT);
+    else
+        _T2D.addFT(t, iCol, iRow);
+#endif
+}
 
-    if (_calMode != POST_CAL_MODE)
-        REPORT_ERROR("WRONG PRE(POST) CALCULATION MODE IN RECONSTRUCTOR");
+template <int kernel>
+inline void Reconstructor::addFT3D(const Complex f,
+                                   const RFLOAT t,
+                                   const RFLOAT iCol,
+                                   const RFLOAT iRow,
+                                   const RFLOAT iSlc)
+{
+    if (kernel == RECONSTRUCTOR_KERNEL_MKB)
+        _F3D.addFT(f, iCol, iRow, iSlc, _pf * _a, _kernelFT);
+    else
+        _F3D.addFT(f, iCol, iRow, iSlc);
 
-    if ((src.nColRL() != _size) ||
-        (src.nRowRL() != _size) ||
-        (ctf.nColRL() != _size) ||
-        (ctf.nRowRL() != _size))
-        REPORT_ERROR("INCORRECT SIZE OF INSERTING IMAGE");
+#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
+    if (kernel == RECONSTRUCTOR_KERNEL_MKB)
+        _T3D.addFT(t, iCol, iRow, iSlc, _pf * _a, _kernelFT);
+    else
+        _T3D.addFT(t, iCol, iRow, iSlc);
 #endif
+}
 
+template <int kernel>
+void Reconstructor::insertKernel(const Image& src,
+                                 const Image& ctf,
+                                 const dmat22& rot,
+                                 const RFLOAT w)
+{
     IMAGE_FOR_EACH_PIXEL_FT(src)
     {
         if (QUAD(i, j) < gsl_pow_2(_maxRadius))
@@ -449,57 +506,168 @@ void Reconstructor::insert(const Image& src,
             dvec2 newCor((double)(i * _pf), (double)(j * _pf));
             dvec2 oldCor = rot * newCor;
 
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            _F2D.addFT(src.getFTHalf(i, j)
-                     * REAL(ctf.getFTHalf(i, j))
-                     * w, 
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1), 
-                       _pf * _a, 
-                       _kernelFT);
-#endif
+            RFLOAT c = REAL(ctf.getFTHalf(i, j));
 
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-            _F2D.addFT(src.getFTHalf(i, j)
-                     * REAL(ctf.getFTHalf(i, j))
-                     * w, 
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1));
-#endif
+            addFT2D<kernel>(src.getFTHalf(i, j) * c * w,
+                            TSGSL_pow_2(c) * w,
+                            (RFLOAT)oldCor(0),
+                            (RFLOAT)oldCor(1));
+        }
+    }
+}
 
-#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
+template <int kernel>
+void Reconstructor::insertKernel(const Image& src,
+                                 const Image& ctf,
+                                 const dmat33& rot,
+                                 const RFLOAT w)
+{
+    const double* ptr = rot.data();
 
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            _T2D.addFT(TSGSL_pow_2(REAL(ctf.getFTHalf(i, j)))
-                     * w, 
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1), 
-                       _pf * _a,
-                       _kernelFT);
-#endif
+    IMAGE_FOR_EACH_PIXEL_FT(src)
+    {
+        if (QUAD(i, j) < gsl_pow_2(_maxRadius))
+        {
+            double oldCor[3];
+            oldCor[0] = (ptr[0] * i + ptr[3] * j) * _pf;
+            oldCor[1] = (ptr[1] * i + ptr[4] * j) * _pf;
+            oldCor[2] = (ptr[2] * i + ptr[5] * j) * _pf;
+
+            RFLOAT c = REAL(ctf.getFTHalf(i, j));
+
+            addFT3D<kernel>(src.getFTHalf(i, j) * c * w,
+                            TSGSL_pow_2(c) * w,
+                            (RFLOAT)oldCor[0],
+                            (RFLOAT)oldCor[1],
+                            (RFLOAT)oldCor[2]);
+        }
+    }
+}
 
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-             _T2D.addFT(TSGSL_pow_2(REAL(ctf.getFTHalf(i, j)))
-                      * w, 
-                        (RFLOAT)oldCor(0), 
+template <int kernel>
+void Reconstructor::insertPKernel(const Image& src,
+                                  const Image& ctf,
+                                  const dmat22& rot,
+                                  const RFLOAT w,
+                                  const vec* sig)
+{
+    for (int i = 0; i < _nPxl; i++)
+    {
+        dvec2 newCor((double)(_iCol[i]), (double)(_iRow[i]));
+        dvec2 oldCor = rot * newCor;
+
+        RFLOAT c = REAL(ctf.iGetFT(_iPxl[i]));
+        RFLOAT s = (sig == NULL ? 1 : (*sig)(_iSig[i])) * w;
+
+        addFT2D<kernel>(src.iGetFT(_iPxl[i]) * c * s,
+                        TSGSL_pow_2(c) * s,
+                        (RFLOAT)oldCor(0),
                         (RFLOAT)oldCor(1));
-#endif
+    }
+}
 
-#endif
+template <int kernel>
+void Reconstructor::insertPKernel(const Image& src,
+                                  const Image& ctf,
+                                  const dmat33& rot,
+                                  const RFLOAT w,
+                                  const vec* sig)
+{
+    vector<dmat33> sr;
+
+    symmetryRotation(sr, rot, _symInsert ? _sym : NULL);
+
+    for (size_t s = 0; s < sr.size(); s++)
+    {
+        const double* ptr = sr[s].data();
+
+        for (int i = 0; i < _nPxl; i++)
+        {
+            double oldCor[3];
+            int iCol = _iCol[i];
+            int iRow = _iRow[i];
+            oldCor[0] = ptr[0] * iCol + ptr[3] * iRow;
+            oldCor[1] = ptr[1] * iCol + ptr[4] * iRow;
+            oldCor[2] = ptr[2] * iCol + ptr[5] * iRow;
+
+            RFLOAT c = REAL(ctf.iGetFT(_iPxl[i]));
+            RFLOAT f = (sig == NULL ? 1 : (*sig)(_iSig[i])) * w;
+
+            addFT3D<kernel>(src.iGetFT(_iPxl[i]) * c * f,
+                            TSGSL_pow_2(c) * f,
+                            (RFLOAT)oldCor[0],
+                            (RFLOAT)oldCor[1],
+                            (RFLOAT)oldCor[2]);
+        }
+    }
+}
+
+template <int kernel>
+void Reconstructor::insertPKernel(const Complex* src,
+                                  const RFLOAT* ctf,
+                                  const dmat22& rot,
+                                  const RFLOAT w,
+                                  const vec* sig)
+{
+    for (int i = 0; i < _nPxl; i++)
+    {
+        dvec2 newCor((double)(_iCol[i]), (double)(_iRow[i]));
+        dvec2 oldCor = rot * newCor;
+
+        RFLOAT s = (sig == NULL ? 1 : (*sig)(_iSig[i])) * w;
+
+        addFT2D<kernel>(src[i] * ctf[i] * s,
+                        TSGSL_pow_2(ctf[i]) * s,
+                        (RFLOAT)oldCor(0),
+                        (RFLOAT)oldCor(1));
+    }
+}
+
+template <int kernel>
+void Reconstructor::insertPKernel(const Complex* src,
+                                  const RFLOAT* ctf,
+                                  const dmat33& rot,
+                                  const RFLOAT w,
+                                  const vec* sig)
+{
+    vector<dmat33> sr;
+
+    symmetryRotation(sr, rot, _symInsert ? _sym : NULL);
+
+    for (size_t s = 0; s < sr.size(); s++)
+    {
+        const double* ptr = sr[s].data();
+
+        for (int i = 0; i < _nPxl; i++)
+        {
+            double oldCor[3];
+            int iCol = _iCol[i];
+            int iRow = _iRow[i];
+            oldCor[0] = ptr[0] * iCol + ptr[3] * iRow;
+            oldCor[1] = ptr[1] * iCol + ptr[4] * iRow;
+            oldCor[2] = ptr[2] * iCol + ptr[5] * iRow;
+
+            RFLOAT f = (sig == NULL ? 1 : (*sig)(_iSig[i])) * w;
+
+            addFT3D<kernel>(src[i] * ctf[i] * f,
+                            TSGSL_pow_2(ctf[i]) * f,
+                            (RFLOAT)oldCor[0],
+                            (RFLOAT)oldCor[1],
+                            (RFLOAT)oldCor[2]);
         }
     }
 }
 
 void Reconstructor::insert(const Image& src,
                            const Image& ctf,
-                           const dmat33& rot,
+                           const dmat22& rot,
                            const RFLOAT w)
 {
 #ifdef RECONSTRUCTOR_ASSERT_CHECK
     IF_MASTER
         REPORT_ERROR("INSERTING IMAGES INTO RECONSTRUCTOR IN MASTER");
 
-    NT_MODE_3D REPORT_ERROR("WRONG MODE");
+    NT_MODE_2D REPORT_ERROR("WRONG MODE");
 
     if (_calMode != POST_CAL_MODE)
         REPORT_ERROR("WRONG PRE(POST) CALCULATION MODE IN RECONSTRUCTOR");
@@ -511,59 +679,31 @@ void Reconstructor::insert(const Image& src,
         REPORT_ERROR("INCORRECT SIZE OF INSERTING IMAGE");
 #endif
 
-        IMAGE_FOR_EACH_PIXEL_FT(src)
-        {
-            if (QUAD(i, j) < gsl_pow_2(_maxRadius))
-            {
-                const double* ptr = rot.data();
-                double oldCor[3];
-                oldCor[0] = (ptr[0] * i + ptr[3] * j) * _pf;
-                oldCor[1] = (ptr[1] * i + ptr[4] * j) * _pf;
-                oldCor[2] = (ptr[2] * i + ptr[5] * j) * _pf;
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-                _F3D.addFT(src.getFTHalf(i, j)
-                         * REAL(ctf.getFTHalf(i, j))
-                         * w, 
-                           (RFLOAT)oldCor[0], 
-                           (RFLOAT)oldCor[1], 
-                           (RFLOAT)oldCor[2], 
-                           _pf * _a, 
-                           _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-                _F3D.addFT(src.getFTHalf(i, j)
-                         * REAL(ctf.getFTHalf(i, j))
-                         * w, 
-                           (RFLOAT)oldCor[0], 
-                           (RFLOAT)oldCor[1], 
-                           (RFLOAT)oldCor[2]);
-#endif
+    RECONSTRUCTOR_DISPATCH(insertKernel, (src, ctf, rot, w));
+}
 
-#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
+void Reconstructor::insert(const Image& src,
+                           const Image& ctf,
+                           const dmat33& rot,
+                           const RFLOAT w)
+{
+#ifdef RECONSTRUCTOR_ASSERT_CHECK
+    IF_MASTER
+        REPORT_ERROR("INSERTING IMAGES INTO RECONSTRUCTOR IN MASTER");
 
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-                _T3D.addFT(TSGSL_pow_2(REAL(ctf.getFTHalf(i, j)))
-                         * w, 
-                           (RFLOAT)oldCor[0], 
-                           (RFLOAT)oldCor[1], 
-                           (RFLOAT)oldCor[2],
-                           _pf * _a,
-                           _kernelFT);
-#endif
+    NT_MODE_3D REPORT_ERROR("WRONG MODE");
 
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-                _T3D.addFT(TSGSL_pow_2(REAL(ctf.getFTHalf(i, j)))
-                         * w, 
-                           (RFLOAT)oldCor[0], 
-                           (RFLOAT)oldCor[1], 
-                           (RFLOAT)oldCor[2]);
-#endif
+    if (_calMode != POST_CAL_MODE)
+        REPORT_ERROR("WRONG PRE(POST) CALCULATION MODE IN RECONSTRUCTOR");
 
+    if ((src.nColRL() != _size) ||
+        (src.nRowRL() != _size) ||
+        (ctf.nColRL() != _size) ||
+        (ctf.nRowRL() != _size))
+        REPORT_ERROR("INCORRECT SIZE OF INSERTING IMAGE");
 #endif
-            }
-        }
+
+    RECONSTRUCTOR_DISPATCH(insertKernel, (src, ctf, rot, w));
 }
 
 void Reconstructor::insertP(const Image& src,
@@ -582,53 +722,7 @@ void Reconstructor::insertP(const Image& src,
         REPORT_ERROR("WRONG PRE(POST) CALCULATION MODE IN RECONSTRUCTOR");
 #endif
 
-        for (int i = 0; i < _nPxl; i++)
-        {
-            dvec2 newCor((double)(_iCol[i]), (double)(_iRow[i]));
-            dvec2 oldCor = rot * newCor;
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            _F2D.addFT(src.iGetFT(_iPxl[i])
-                     * REAL(ctf.iGetFT(_iPxl[i]))
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1), 
-                       _pf * _a, 
-                       _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-            _F2D.addFT(src.iGetFT(_iPxl[i])
-                     * REAL(ctf.iGetFT(_iPxl[i]))
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1));
-#endif
-
-#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            _T2D.addFT(TSGSL_pow_2(REAL(ctf.iGetFT(_iPxl[i])))
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1), 
-                       _pf * _a,
-                       _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-            _T2D.addFT(TSGSL_pow_2(REAL(ctf.iGetFT(_iPxl[i])))
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1));
-#endif
-
-#endif
-        }
+    RECONSTRUCTOR_DISPATCH(insertPKernel, (src, ctf, rot, w, sig));
 }
 
 void Reconstructor::insertP(const Image& src,
@@ -647,62 +741,7 @@ void Reconstructor::insertP(const Image& src,
         REPORT_ERROR("WRONG PRE(POST) CALCULATION MODE IN RECONSTRUCTOR");
 #endif
 
-    for (int i = 0; i < _nPxl; i++)
-    {
-        const double* ptr = rot.data();
-        double oldCor[3];
-        int iCol = _iCol[i];
-        int iRow = _iRow[i];
-        oldCor[0] = ptr[0] * iCol + ptr[3] * iRow;
-        oldCor[1] = ptr[1] * iCol + ptr[4] * iRow;
-        oldCor[2] = ptr[2] * iCol + ptr[5] * iRow;
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-        _F3D.addFT(src.iGetFT(_iPxl[i])
-                 * REAL(ctf.iGetFT(_iPxl[i]))
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0],
-                   (RFLOAT)oldCor[1],
-                   (RFLOAT)oldCor[2],
-                   _pf * _a, 
-                   _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-        _F3D.addFT(src.iGetFT(_iPxl[i])
-                 * REAL(ctf.iGetFT(_iPxl[i]))
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0],
-                   (RFLOAT)oldCor[1],
-                   (RFLOAT)oldCor[2]);
-#endif
-
-#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-        _T3D.addFT(TSGSL_pow_2(REAL(ctf.iGetFT(_iPxl[i])))
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0],
-                   (RFLOAT)oldCor[1],
-                   (RFLOAT)oldCor[2],
-                   _pf * _a,
-                   _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-        _T3D.addFT(TSGSL_pow_2(REAL(ctf.iGetFT(_iPxl[i])))
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0],
-                   (RFLOAT)oldCor[1],
-                   (RFLOAT)oldCor[2]);
-#endif
-
-#endif
-    }
+    RECONSTRUCTOR_DISPATCH(insertPKernel, (src, ctf, rot, w, sig));
 }
 
 void Reconstructor::insertP(const Complex* src,
@@ -730,53 +769,7 @@ void Reconstructor::insertP(const Complex* src,
 
 #endif
 
-        for (int i = 0; i < _nPxl; i++)
-        {
-            dvec2 newCor((double)(_iCol[i]), (double)(_iRow[i]));
-            dvec2 oldCor = rot * newCor;
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            _F2D.addFT(src[i]
-                     * ctf[i]
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1), 
-                       _pf * _a, 
-                       _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-            _F2D.addFT(src[i]
-                     * ctf[i]
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1));
-#endif
-
-#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            _T2D.addFT(TSGSL_pow_2(ctf[i])
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1), 
-                       _pf * _a,
-                       _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-            _T2D.addFT(TSGSL_pow_2(ctf[i])
-                     * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                     * w,
-                       (RFLOAT)oldCor(0), 
-                       (RFLOAT)oldCor(1));
-#endif
-
-#endif
-        }
+    RECONSTRUCTOR_DISPATCH(insertPKernel, (src, ctf, rot, w, sig));
 }
 
 void Reconstructor::insertP(const Complex* src,
@@ -804,62 +797,7 @@ void Reconstructor::insertP(const Complex* src,
 
 #endif
 
-    for (int i = 0; i < _nPxl; i++)
-    {
-        const double* ptr = rot.data();
-        double oldCor[3];
-        int iCol = _iCol[i];
-        int iRow = _iRow[i];
-        oldCor[0] = ptr[0] * iCol + ptr[3] * iRow;
-        oldCor[1] = ptr[1] * iCol + ptr[4] * iRow;
-        oldCor[2] = ptr[2] * iCol + ptr[5] * iRow;
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-        _F3D.addFT(src[i]
-                 * ctf[i]
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0], 
-                   (RFLOAT)oldCor[1], 
-                   (RFLOAT)oldCor[2], 
-                   _pf * _a, 
-                   _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-        _F3D.addFT(src[i]
-                 * ctf[i]
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0], 
-                   (RFLOAT)oldCor[1], 
-                   (RFLOAT)oldCor[2]);
-#endif
-
-#ifdef RECONSTRUCTOR_ADD_T_DURING_INSERT
-
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-        _T3D.addFT(TSGSL_pow_2(ctf[i])
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0], 
-                   (RFLOAT)oldCor[1], 
-                   (RFLOAT)oldCor[2],
-                   _pf * _a,
-                   _kernelFT);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-        _T3D.addFT(TSGSL_pow_2(ctf[i])
-                 * (sig == NULL ? 1 : (*sig)(_iSig[i]))
-                 * w,
-                   (RFLOAT)oldCor[0], 
-                   (RFLOAT)oldCor[1], 
-                   (RFLOAT)oldCor[2]);
-#endif
-
-#endif
-    }
+    RECONSTRUCTOR_DISPATCH(insertPKernel, (src, ctf, rot, w, sig));
 }
 
 #ifdef GPU_INSERT
@@ -1002,8 +940,7 @@ void Reconstructor::getF(Complex* modelF)
 
 void Reconstructor::getT(RFLOAT* modelT)
 {
-    for(size_t i = 0; i < _T2D.sizeFT(); i++)
-        modelT[i] = REAL(_T2D[i]);
+    memcpy(modelT, _T2D.dataFT(), _T2D.sizeFT() * sizeof(RFLOAT));
 }
 
 void Reconstructor::resetF(Complex* modelF)
@@ -1014,8 +951,7 @@ void Reconstructor::resetF(Complex* modelF)
 
 void Reconstructor::resetT(RFLOAT* modelT)
 {
-    for(size_t i = 0; i < _T2D.sizeFT(); i++)
-        _T2D[i] = COMPLEX(modelT[i], 0);
+    memcpy(_T2D.dataFT(), modelT, _T2D.sizeFT() * sizeof(RFLOAT));
 }
 
 void Reconstructor::prepareTFG(int gpuIdx)
@@ -1066,26 +1002,32 @@ void Reconstructor::prepareTF(const unsigned int nThread)
     IF_MODE_3D
     {
 #ifdef RECONSTRUCTOR_SYMMETRIZE_DURING_RECONSTRUCT
-        ALOG(INFO, "LOGGER_RECO") << "Symmetrizing T";
-        BLOG(INFO, "LOGGER_RECO") << "Symmetrizing T";
+        if (!_symInsert)
+        {
+            ALOG(INFO, "LOGGER_RECO") << "Symmetrizing T";
+            BLOG(INFO, "LOGGER_RECO") << "Symmetrizing T";
 
-        symmetrizeT(nThread);
+            symmetrizeT(nThread);
+        }
 #endif
     }
 
     ALOG(INFO, "LOGGER_RECO") << "Allreducing F";
     BLOG(INFO, "LOGGER_RECO") << "Allreducing F";
 
-    allReduceF();
+    allReduceF(nThread);
 
     // only in 3D mode, symmetry should be considered
     IF_MODE_3D
     {
 #ifdef RECONSTRUCTOR_SYMMETRIZE_DURING_RECONSTRUCT
-        ALOG(INFO, "LOGGER_RECO") << "Symmetrizing F";
-        BLOG(INFO, "LOGGER_RECO") << "Symmetrizing F";
+        if (!_symInsert)
+        {
+            ALOG(INFO, "LOGGER_RECO") << "Symmetrizing F";
+            BLOG(INFO, "LOGGER_RECO") << "Symmetrizing F";
 
-        symmetrizeF(nThread);
+            symmetrizeF(nThread);
+        }
 #endif
     }
 }
@@ -1162,14 +1104,12 @@ void Reconstructor::reconstruct(Volume& dst,
         {
             ringAverage(avg,
                         _T2D,
-                        gsl_real,
                         _maxRadius * _pf - 1);
         }
         else if (_mode == MODE_3D)
         {
             shellAverage(avg,
                          _T3D,
-                         gsl_real,
                          _maxRadius * _pf - 1,
                          nThread);
         }
@@ -1228,12 +1168,12 @@ void Reconstructor::reconstruct(Volume& dst,
 #endif
 
 #ifdef RECONSTRUCTOR_WIENER_FILTER_FSC_FREQ_AVG
-                    _T2D.setFT(_T2D.getFT(i, j)
-                             + COMPLEX((1 - FSC) / FSC * avg(u), 0),
-                               i,
-                               j);
+                    _T2D.setFTHalf(_T2D.getFTHalf(i, j)
+                                 + (1 - FSC) / FSC * avg(u),
+                                   i,
+                                   j);
 #else
-                    _T2D.setFT(_T2D.getFT(i, j) / FSC, i, j);
+                    _T2D.setFTHalf(_T2D.getFTHalf(i, j) / FSC, i, j);
 #endif
                 }
         }
@@ -1259,13 +1199,13 @@ void Reconstructor::reconstruct(Volume& dst,
 #endif
 
 #ifdef RECONSTRUCTOR_WIENER_FILTER_FSC_FREQ_AVG
-                    _T3D.setFT(_T3D.getFT(i, j, k)
-                             + COMPLEX((1 - FSC) / FSC * avg(u), 0),
-                               i,
-                               j,
-                               k);
+                    _T3D.setFTHalf(_T3D.getFTHalf(i, j, k)
+                                 + (1 - FSC) / FSC * avg(u),
+                                   i,
+                                   j,
+                                   k);
 #else
-                    _T3D.setFT(_T3D.getFT(i, j, k) / FSC, i, j, k);
+                    _T3D.setFTHalf(_T3D.getFTHalf(i, j, k) / FSC, i, j, k);
 #endif
                 }
         }
@@ -1290,18 +1230,18 @@ void Reconstructor::reconstruct(Volume& dst,
         #pragma omp parallel for num_threads(nThread)
         IMAGE_FOR_EACH_PIXEL_FT(_W2D)
             if (QUAD(i, j) < TSGSL_pow_2(_maxRadius * _pf))
-                _W2D.setFTHalf(COMPLEX(1, 0), i, j);
+                _W2D.setFTHalf(1, i, j);
             else
-                _W2D.setFTHalf(COMPLEX(0, 0), i, j);
+                _W2D.setFTHalf(0, i, j);
     }
     else if (_mode == MODE_3D)
     {
         #pragma omp parallel for num_threads(nThread)
         VOLUME_FOR_EACH_PIXEL_FT(_W3D)
             if (QUAD_3(i, j, k) < TSGSL_pow_2(_maxRadius * _pf))
-                _W3D.setFTHalf(COMPLEX(1, 0), i, j, k);
+                _W3D.setFTHalf(1, i, j, k);
             else
-                _W3D.setFTHalf(COMPLEX(0, 0), i, j, k);
+                _W3D.setFTHalf(0, i, j, k);
     }
     else
     {
@@ -1315,13 +1255,13 @@ void Reconstructor::reconstruct(Volume& dst,
     {
         #pragma omp parallel for num_threads(nThread)
         FOR_EACH_PIXEL_FT(_T2D)
-            _T2D[i].dat[0] = TSGSL_MAX_RFLOAT(_T2D[i].dat[0], 1e-25);
+            _T2D[i] = TSGSL_MAX_RFLOAT(_T2D[i], 1e-25);
     }
     else if (_mode == MODE_3D)
     {
         #pragma omp parallel for num_threads(nThread)
         FOR_EACH_PIXEL_FT(_T3D)
-            _T3D[i].dat[0] = TSGSL_MAX_RFLOAT(_T3D[i].dat[0], 1e-25);
+            _T3D[i] = TSGSL_MAX_RFLOAT(_T3D[i], 1e-25);
     }
     else
     {
@@ -1334,15 +1274,15 @@ void Reconstructor::reconstruct(Volume& dst,
     if (_mode == MODE_2D)
     {
         SEGMENT_NAN_CHECK_COMPLEX(_F2D.dataFT(), _F2D.sizeFT());
-        SEGMENT_NAN_CHECK_COMPLEX(_W2D.dataFT(), _W2D.sizeFT());
-        SEGMENT_NAN_CHECK_COMPLEX(_T2D.dataFT(), _T2D.sizeFT());
+        SEGMENT_NAN_CHECK(_W2D.dataFT(), _W2D.sizeFT());
+        SEGMENT_NAN_CHECK(_T2D.dataFT(), _T2D.sizeFT());
         SEGMENT_NAN_CHECK_COMPLEX(_C2D.dataFT(), _C2D.sizeFT());
     }
     else if (_mode == MODE_3D)
     {
         SEGMENT_NAN_CHECK_COMPLEX(_F3D.dataFT(), _F3D.sizeFT());
-        SEGMENT_NAN_CHECK_COMPLEX(_W3D.dataFT(), _W3D.sizeFT());
-        SEGMENT_NAN_CHECK_COMPLEX(_T3D.dataFT(), _T3D.sizeFT());
+        SEGMENT_NAN_CHECK(_W3D.dataFT(), _W3D.sizeFT());
+        SEGMENT_NAN_CHECK(_T3D.dataFT(), _T3D.sizeFT());
         SEGMENT_NAN_CHECK_COMPLEX(_C3D.dataFT(), _C3D.sizeFT());
     }
     else
@@ -1362,6 +1302,22 @@ void Reconstructor::reconstruct(Volume& dst,
 
         int nDiffCNoDecrease = 0;
 
+        // W of the last round, for extrapolating the update
+        vector<RFLOAT> wPrev((_mode == MODE_2D) ? _W2D.sizeFT() : _W3D.sizeFT());
+
+        if (_mode == MODE_2D)
+        {
+            #pragma omp parallel for num_threads(nThread)
+            FOR_EACH_PIXEL_FT(_W2D)
+                wPrev[i] = _W2D[i];
+        }
+        else
+        {
+            #pragma omp parallel for num_threads(nThread)
+            FOR_EACH_PIXEL_FT(_W3D)
+                wPrev[i] = _W3D[i];
+        }
+
         for (m = 0; m < MAX_N_ITER_BALANCE; m++)
         {
 #ifdef VERBOSE_LEVEL_2
@@ -1377,13 +1333,13 @@ void Reconstructor::reconstruct(Volume& dst,
             if (_mode == MODE_2D)
             {
 #ifndef NAN_NO_CHECK
-                SEGMENT_NAN_CHECK_COMPLEX(_T2D.dataFT(), _T2D.sizeFT());
-                SEGMENT_NAN_CHECK_COMPLEX(_W2D.dataFT(), _W2D.sizeFT());
+                SEGMENT_NAN_CHECK(_T2D.dataFT(), _T2D.sizeFT());
+                SEGMENT_NAN_CHECK(_W2D.dataFT(), _W2D.sizeFT());
 #endif
 
                 #pragma omp parallel for num_threads(nThread)
                 FOR_EACH_PIXEL_FT(_C2D)
-                    _C2D[i] = _T2D[i] * REAL(_W2D[i]);
+                    _C2D[i] = COMPLEX(_T2D[i] * _W2D[i], 0);
 
 #ifndef NAN_NO_CHECK
                 SEGMENT_NAN_CHECK_COMPLEX(_C2D.dataFT(), _C2D.sizeFT());
@@ -1392,13 +1348,13 @@ void Reconstructor::reconstruct(Volume& dst,
             else if (_mode == MODE_3D)
             {
 #ifndef NAN_NO_CHECK
-                SEGMENT_NAN_CHECK_COMPLEX(_T3D.dataFT(), _T3D.sizeFT());
-                SEGMENT_NAN_CHECK_COMPLEX(_W3D.dataFT(), _W3D.sizeFT());
+                SEGMENT_NAN_CHECK(_T3D.dataFT(), _T3D.sizeFT());
+                SEGMENT_NAN_CHECK(_W3D.dataFT(), _W3D.sizeFT());
 #endif
 
                 #pragma omp parallel for num_threads(nThread)
                 FOR_EACH_PIXEL_FT(_C3D)
-                    _C3D[i] = _T3D[i] * REAL(_W3D[i]);
+                    _C3D[i] = COMPLEX(_T3D[i] * _W3D[i], 0);
 
 #ifndef NAN_NO_CHECK
                 SEGMENT_NAN_CHECK_COMPLEX(_C3D.dataFT(), _C3D.sizeFT());
@@ -1420,6 +1376,41 @@ void Reconstructor::reconstruct(Volume& dst,
 
             convoluteC(nThread);
 
+#ifdef VERBOSE_LEVEL_2
+
+            ALOG(INFO, "LOGGER_RECO") << "Calculating Distance to Total Balanced";
+            BLOG(INFO, "LOGGER_RECO") << "Calculating Distance to Total Balanced";
+
+#endif
+
+            diffCPrev = diffC;
+
+            diffC = checkC(nThread);
+ 
+#ifdef VERBOSE_LEVEL_2
+
+            ALOG(INFO, "LOGGER_SYS") << "After "
+                                     << m
+                                     << " Iterations, Distance to Total Balanced: "
+                                     << diffC;
+            BLOG(INFO, "LOGGER_SYS") << "After "
+                                     << m
+                                     << " Iterations, Distance to Total Balanced: "
+                                     << diffC;
+
+#endif
+
+#ifdef VERBOSE_LEVEL_2
+
+            ALOG(INFO, "LOGGER_RECO") << "Distance to Total Balanced: " << diffC;
+            BLOG(INFO, "LOGGER_RECO") << "Distance to Total Balanced: " << diffC;
+
+#endif
+
+            // heavy ball momentum in log domain, restarted once the distance
+            // stops decreasing
+            RFLOAT beta = (diffC < diffCPrev) ? BALANCE_MOMENTUM : 0;
+
 #ifdef VERBOSE_LEVEL_2
 
             ALOG(INFO, "LOGGER_RECO") << "Re-Calculating W";
@@ -1430,7 +1421,7 @@ void Reconstructor::reconstruct(Volume& dst,
             if (_mode == MODE_2D)
             {
 #ifndef NAN_NO_CHECK
-                SEGMENT_NAN_CHECK_COMPLEX(_W2D.dataFT(), _W2D.sizeFT());
+                SEGMENT_NAN_CHECK(_W2D.dataFT(), _W2D.sizeFT());
                 SEGMENT_NAN_CHECK_COMPLEX(_C2D.dataFT(), _C2D.sizeFT());
 #endif
 
@@ -1450,11 +1441,15 @@ void Reconstructor::reconstruct(Volume& dst,
                         }
                         ***/
 
-                        _W2D.setFTHalf(_W2D.getFTHalf(i, j)
-                                     / TSGSL_MAX_RFLOAT(ABS(_C2D.getFTHalf(i, j)),
-                                                        1e-6),
-                                       i,
-                                       j);
+                        size_t index = _W2D.iFTHalf(i, j);
+
+                        RFLOAT w = _W2D[index];
+
+                        _W2D[index] = w
+                                    / TSGSL_MAX_RFLOAT(ABS(_C2D[index]), 1e-6)
+                                    * pow(w / wPrev[index], beta);
+
+                        wPrev[index] = w;
 
                         /***
                         if (IS_NAN(REAL(_W2D.getFTHalf(i, j)))
@@ -1478,28 +1473,33 @@ void Reconstructor::reconstruct(Volume& dst,
                     }
 
 #ifndef NAN_NO_CHECK
-                SEGMENT_NAN_CHECK_COMPLEX(_W2D.dataFT(), _W2D.sizeFT());
+                SEGMENT_NAN_CHECK(_W2D.dataFT(), _W2D.sizeFT());
 #endif
             }
             else if (_mode == MODE_3D)
             {
 #ifndef NAN_NO_CHECK
-                SEGMENT_NAN_CHECK_COMPLEX(_W3D.dataFT(), _W3D.sizeFT());
+                SEGMENT_NAN_CHECK(_W3D.dataFT(), _W3D.sizeFT());
                 SEGMENT_NAN_CHECK_COMPLEX(_C3D.dataFT(), _C3D.sizeFT());
 #endif
 
                 #pragma omp parallel for schedule(dynamic) num_threads(nThread)
                 VOLUME_FOR_EACH_PIXEL_FT(_W3D)
                     if (QUAD_3(i, j, k) < gsl_pow_2(_maxRadius * _pf))
-                        _W3D.setFTHalf(_W3D.getFTHalf(i, j, k)
-                                     / TSGSL_MAX_RFLOAT(ABS(_C3D.getFTHalf(i, j, k)),
-                                                   1e-6),
-                                       i,
-                                       j,
-                                       k);
+                    {
+                        size_t index = _W3D.iFTHalf(i, j, k);
+
+                        RFLOAT w = _W3D[index];
+
+                        _W3D[index] = w
+                                    / TSGSL_MAX_RFLOAT(ABS(_C3D[index]), 1e-6)
+                                    * pow(w / wPrev[index], beta);
+
+                        wPrev[index] = w;
+                    }
 
 #ifndef NAN_NO_CHECK
-                SEGMENT_NAN_CHECK_COMPLEX(_W3D.dataFT(), _W3D.sizeFT());
+                SEGMENT_NAN_CHECK(_W3D.dataFT(), _W3D.sizeFT());
 #endif
             }
             else
@@ -1509,37 +1509,6 @@ void Reconstructor::reconstruct(Volume& dst,
                 abort();
             }
 
-#ifdef VERBOSE_LEVEL_2
-
-            ALOG(INFO, "LOGGER_RECO") << "Calculating Distance to Total Balanced";
-            BLOG(INFO, "LOGGER_RECO") << "Calculating Distance to Total Balanced";
-
-#endif
-
-            diffCPrev = diffC;
-
-            diffC = checkC(nThread);
- 
-#ifdef VERBOSE_LEVEL_2
-
-            ALOG(INFO, "LOGGER_SYS") << "After "
-                                     << m
-                                     << " Iterations, Distance to Total Balanced: "
-                                     << diffC;
-            BLOG(INFO, "LOGGER_SYS") << "After "
-                                     << m
-                                     << " Iterations, Distance to Total Balanced: "
-                                     << diffC;
-
-#endif
-
-#ifdef VERBOSE_LEVEL_2
-
-            ALOG(INFO, "LOGGER_RECO") << "Distance to Total Balanced: " << diffC;
-            BLOG(INFO, "LOGGER_RECO") << "Distance to Total Balanced: " << diffC;
-
-#endif
-
             if (diffC > diffCPrev * DIFF_C_DECREASE_THRES)
                 nDiffCNoDecrease += 1;
             else
@@ -1549,6 +1518,15 @@ void Reconstructor::reconstruct(Volume& dst,
                 ((m >= MIN_N_ITER_BALANCE) &&
                 (nDiffCNoDecrease == N_DIFF_C_NO_DECREASE))) break;
         }
+
+        ALOG(INFO, "LOGGER_RECO") << "Balanced Weights in "
+                                  << GSL_MIN_INT(m + 1, MAX_N_ITER_BALANCE)
+                                  << " Rounds, Distance to Total Balanced: "
+                                  << diffC;
+        BLOG(INFO, "LOGGER_RECO") << "Balanced Weights in "
+                                  << GSL_MIN_INT(m + 1, MAX_N_ITER_BALANCE)
+                                  << " Rounds, Distance to Total Balanced: "
+                                  << diffC;
     }
     else
     {
@@ -1558,10 +1536,9 @@ void Reconstructor::reconstruct(Volume& dst,
             #pragma omp parallel for schedule(dynamic) num_threads(nThread)
             IMAGE_FOR_EACH_PIXEL_FT(_W2D)
                 if (QUAD(i, j) < TSGSL_pow_2(_maxRadius * _pf))
-                    _W2D.setFTHalf(COMPLEX(1.0
-                                         / TSGSL_MAX_RFLOAT(ABS(_T2D.getFTHalf(i, j)),
-                                                       1e-6),
-                                           0),
+                    _W2D.setFTHalf(1.0
+                                 / TSGSL_MAX_RFLOAT(fabs(_T2D.getFTHalf(i, j)),
+                                                    1e-6),
                                    i,
                                    j);
         }
@@ -1570,10 +1547,9 @@ void Reconstructor::reconstruct(Volume& dst,
             #pragma omp parallel for schedule(dynamic) num_threads(nThread)
             VOLUME_FOR_EACH_PIXEL_FT(_W3D)
                 if (QUAD_3(i, j, k) < TSGSL_pow_2(_maxRadius * _pf))
-                    _W3D.setFTHalf(COMPLEX(1.0
-                                         / TSGSL_MAX_RFLOAT(ABS(_T3D.getFTHalf(i, j, k)),
-                                                       1e-6),
-                                           0),
+                    _W3D.setFTHalf(1.0
+                                 / TSGSL_MAX_RFLOAT(fabs(_T3D.getFTHalf(i, j, k)),
+                                                    1e-6),
                                    i,
                                    j,
                                    k);
@@ -1590,7 +1566,7 @@ void Reconstructor::reconstruct(Volume& dst,
     {
 #ifndef NAN_NO_CHECK
         SEGMENT_NAN_CHECK_COMPLEX(_F2D.dataFT(), _F2D.sizeFT());
-        SEGMENT_NAN_CHECK_COMPLEX(_W2D.dataFT(), _W2D.sizeFT());
+        SEGMENT_NAN_CHECK(_W2D.dataFT(), _W2D.sizeFT());
 #endif
 
 #ifdef VERBOSE_LEVEL_2
@@ -1743,9 +1719,9 @@ void Reconstructor::reconstruct(Volume& dst,
 
 #endif
 
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-    RFLOAT nf = MKB_RL(0, _a * _pf, _alpha);
-#endif
+    RFLOAT nf = (_kernelType == RECONSTRUCTOR_KERNEL_MKB)
+              ? MKB_RL(0, _a * _pf, _alpha)
+              : 1;
 
     if (_mode == MODE_2D)
     {
@@ -1756,22 +1732,19 @@ void Reconstructor::reconstruct(Volume& dst,
         #pragma omp parallel for schedule(dynamic) num_threads(nThread)
         IMAGE_FOR_EACH_PIXEL_RL(imgDst)
         {
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            imgDst.setRL(imgDst.getRL(i, j)
-                       / MKB_RL(NORM(i, j) / (_pf * _N),
-                                _a * _pf,
-                                _alpha)
-                       * nf,
-                         i,
-                         j);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-            imgDst.setRL(imgDst.getRL(i, j)
-                       / TIK_RL(NORM(i, j) / (_pf * _N)),
-                         i,
-                         j);
-#endif
+            if (_kernelType == RECONSTRUCTOR_KERNEL_MKB)
+                imgDst.setRL(imgDst.getRL(i, j)
+                           / MKB_RL(NORM(i, j) / (_pf * _N),
+                                    _a * _pf,
+                                    _alpha)
+                           * nf,
+                             i,
+                             j);
+            else
+                imgDst.setRL(imgDst.getRL(i, j)
+                           / TIK_RL(NORM(i, j) / (_pf * _N)),
+                             i,
+                             j);
         }
 
         SLC_REPLACE_RL(dst, imgDst, 0);
@@ -1781,24 +1754,21 @@ void Reconstructor::reconstruct(Volume& dst,
         #pragma omp parallel for schedule(dynamic) num_threads(nThread)
         VOLUME_FOR_EACH_PIXEL_RL(dst)
         {
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-            dst.setRL(dst.getRL(i, j, k)
-                     / MKB_RL(NORM_3(i, j, k) / (_pf * _N),
-                              _a * _pf,
-                              _alpha)
-                     * nf,
-                       i,
-                       j,
-                       k);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-            dst.setRL(dst.getRL(i, j, k)
-                     / TIK_RL(NORM_3(i, j, k) / (_pf * _N)),
-                       i,
-                       j,
-                       k);
-#endif
+            if (_kernelType == RECONSTRUCTOR_KERNEL_MKB)
+                dst.setRL(dst.getRL(i, j, k)
+                         / MKB_RL(NORM_3(i, j, k) / (_pf * _N),
+                                  _a * _pf,
+                                  _alpha)
+                         * nf,
+                           i,
+                           j,
+                           k);
+            else
+                dst.setRL(dst.getRL(i, j, k)
+                         / TIK_RL(NORM_3(i, j, k) / (_pf * _N)),
+                           i,
+                           j,
+                           k);
         }
     }
     else
@@ -1863,8 +1833,8 @@ void Reconstructor::reconstructG(Volume& dst,
 	    
         for(size_t i = 0; i < dimSize; i++)
 	    {
-            volumeT[i] = REAL(_T2D[i]);
-            volumeW[i] = REAL(_W2D[i]);
+            volumeT[i] = _T2D[i];
+            volumeW[i] = _W2D[i];
 	    }
     }
     else if (_mode == MODE_3D)
@@ -1875,8 +1845,8 @@ void Reconstructor::reconstructG(Volume& dst,
 	    
         for(size_t i = 0; i < dimSize; i++)
 	    {
-            volumeT[i] = REAL(_T3D[i]);
-            volumeW[i] = REAL(_W3D[i]);
+            volumeT[i] = _T3D[i];
+            volumeW[i] = _W3D[i];
 	    }
     }
     else
@@ -1925,14 +1895,14 @@ void Reconstructor::reconstructG(Volume& dst,
     {
         for (size_t i = 0; i < _T2D.sizeFT(); i++)
 	    {
-            _T2D[i] = COMPLEX(volumeT[i], 0);
+            _T2D[i] = volumeT[i];
 	    }
     }
     else if (_mode == MODE_3D)
     {
         for (size_t i = 0; i < _T3D.sizeFT(); i++)
 	    {
-            _T3D[i] = COMPLEX(volumeT[i], 0);
+            _T3D[i] = volumeT[i];
 	    }
     }
  
@@ -2185,9 +2155,8 @@ void Reconstructor::reconstructG(Volume& dst,
         dstT.clearRL();
         
         RFLOAT nf = 0;
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-        nf = MKB_RL(0, _a * _pf, _alpha);
-#endif
+        if (_kernelType == RECONSTRUCTOR_KERNEL_MKB)
+            nf = MKB_RL(0, _a * _pf, _alpha);
 
         dst.alloc(_N, _N, 1, FT_SPACE);
 
@@ -2200,15 +2169,12 @@ void Reconstructor::reconstructG(Volume& dst,
             {
                 size_t index = j * (dim / 2 + 1) + i;
         
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-                mkbRL[index] = MKB_RL(NORM(i, j) / padSize,
-                                  _a * _pf,
-                                  _alpha);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-                mkbRL[index] = TIK_RL(NORM(i, j) / padSize);
-#endif
+                if (_kernelType == RECONSTRUCTOR_KERNEL_MKB)
+                    mkbRL[index] = MKB_RL(NORM(i, j) / padSize,
+                                      _a * _pf,
+                                      _alpha);
+                else
+                    mkbRL[index] = TIK_RL(NORM(i, j) / padSize);
             }
     
         ExposeCorrF2D(gpuIdx,
@@ -2282,9 +2248,8 @@ void Reconstructor::reconstructG(Volume& dst,
         padDst.clearRL();
 
         RFLOAT nf = 0;
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-        nf = MKB_RL(0, _a * _pf, _alpha);
-#endif
+        if (_kernelType == RECONSTRUCTOR_KERNEL_MKB)
+            nf = MKB_RL(0, _a * _pf, _alpha);
 
         int padSize = _pf * _N;
         //int dim = dstN.nSlcRL();
@@ -2298,15 +2263,12 @@ void Reconstructor::reconstructG(Volume& dst,
                 {
                     size_t index = k * slcSize + j * (dim / 2 + 1) + i;
         
-#ifdef RECONSTRUCTOR_MKB_KERNEL
-                    mkbRL[index] = MKB_RL(NORM_3(i, j, k) / padSize,
-                                      _a * _pf,
-                                      _alpha);
-#endif
-
-#ifdef RECONSTRUCTOR_TRILINEAR_KERNEL
-                    mkbRL[index] = TIK_RL(NORM_3(i, j, k) / padSize);
-#endif
+                    if (_kernelType == RECONSTRUCTOR_KERNEL_MKB)
+                        mkbRL[index] = MKB_RL(NORM_3(i, j, k) / padSize,
+                                          _a * _pf,
+                                          _alpha);
+                    else
+                        mkbRL[index] = TIK_RL(NORM_3(i, j, k) / padSize);
                 }
     
         ExposeCorrF(gpuIdx,
@@ -2347,48 +2309,56 @@ void Reconstructor::reconstructG(Volume& dst,
 
 #endif // GPU_RECONSTRUCT
 
-void Reconstructor::allReduceF()
+void Reconstructor::startAllReduceTF()
 {
+    IF_MASTER return;
 
-    ALOG(INFO, "LOGGER_RECO") << "Waiting for Synchronizing all Processes in Hemisphere A";
-    BLOG(INFO, "LOGGER_RECO") << "Waiting for Synchronizing all Processes in Hemisphere B";
+    if (_reduceTF) return;
 
-    MPI_Barrier(_hemi);
+    ALOG(INFO, "LOGGER_RECO") << "Starting Allreducing T and F in Hemisphere A";
+    BLOG(INFO, "LOGGER_RECO") << "Starting Allreducing T and F in Hemisphere B";
 
     if (_mode == MODE_2D)
     {
-
 #ifndef NAN_NO_CHECK
+        SEGMENT_NAN_CHECK(_T2D.dataFT(), _T2D.sizeFT());
         SEGMENT_NAN_CHECK_COMPLEX(&_F2D[0], _F2D.sizeFT());
 #endif
 
-        MPI_Allreduce_Large(&_F2D[0],
-                            2 * _F2D.sizeFT(),
-                            TS_MPI_DOUBLE,
-                            MPI_SUM,
-                            _hemi);
-
-#ifndef NAN_NO_CHECK
-        SEGMENT_NAN_CHECK_COMPLEX(&_F2D[0], _F2D.sizeFT());
-#endif
+        MPI_Iallreduce_Large(_T2D.dataFT(),
+                             _T2D.sizeFT(),
+                             TS_MPI_DOUBLE,
+                             MPI_SUM,
+                             _hemi,
+                             _reqT);
 
+        MPI_Iallreduce_Large(&_F2D[0],
+                             2 * _F2D.sizeFT(),
+                             TS_MPI_DOUBLE,
+                             MPI_SUM,
+                             _hemi,
+                             _reqF);
     }
     else if (_mode == MODE_3D)
     {
-
 #ifndef NAN_NO_CHECK
+        SEGMENT_NAN_CHECK(_T3D.dataFT(), _T3D.sizeFT());
         SEGMENT_NAN_CHECK_COMPLEX(&_F3D[0], _F3D.sizeFT());
 #endif
 
-        MPI_Allreduce_Large(&_F3D[0],
-                            2 * _F3D.sizeFT(),
-                            TS_MPI_DOUBLE,
-                            MPI_SUM,
-                            _hemi);
+        MPI_Iallreduce_Large(_T3D.dataFT(),
+                             _T3D.sizeFT(),
+                             TS_MPI_DOUBLE,
+                             MPI_SUM,
+                             _hemi,
+                             _reqT);
 
-#ifndef NAN_NO_CHECK
-        SEGMENT_NAN_CHECK_COMPLEX(&_F3D[0], _F3D.sizeFT());
-#endif
+        MPI_Iallreduce_Large(&_F3D[0],
+                             2 * _F3D.sizeFT(),
+                             TS_MPI_DOUBLE,
+                             MPI_SUM,
+                             _hemi,
+                             _reqF);
     }
     else
     {
@@ -2397,50 +2367,71 @@ void Reconstructor::allReduceF()
         abort();
     }
 
-    MPI_Barrier(_hemi);
+    _reduceTF = true;
 }
 
-void Reconstructor::allReduceT(const unsigned int nThread)
+void Reconstructor::allReduceF(const unsigned int nThread)
 {
-    ALOG(INFO, "LOGGER_RECO") << "Waiting for Synchronizing all Processes in Hemisphere A";
-    BLOG(INFO, "LOGGER_RECO") << "Waiting for Synchronizing all Processes in Hemisphere B";
+    startAllReduceTF();
+
+    ALOG(INFO, "LOGGER_RECO") << "Waiting for Allreducing F in Hemisphere A";
+    BLOG(INFO, "LOGGER_RECO") << "Waiting for Allreducing F in Hemisphere B";
 
-    MPI_Barrier(_hemi);
+    // _T is waited for ahead of _F, keeping the order of the chunks started
+    MPI_Wait_Large(_reqT);
+    MPI_Wait_Large(_reqF);
 
+    _reduceTF = false;
 
     if (_mode == MODE_2D)
     {
-
-#ifndef NAN_NO_CHECK
-        SEGMENT_NAN_CHECK_COMPLEX(&_T2D[0], _T2D.sizeFT());
+#ifdef RECONSTRUCTOR_NORMALISE_T_F
+        #pragma omp parallel for num_threads(nThread)
+        SCALE_FT(_F2D, _sfF);
 #endif
 
-        MPI_Allreduce_Large(&_T2D[0],
-                            2 * _T2D.sizeFT(),
-                            TS_MPI_DOUBLE,
-                            MPI_SUM,
-                            _hemi);
-
 #ifndef NAN_NO_CHECK
-        SEGMENT_NAN_CHECK_COMPLEX(&_T2D[0], _T2D.sizeFT());
+        SEGMENT_NAN_CHECK_COMPLEX(&_F2D[0], _F2D.sizeFT());
 #endif
-
     }
     else if (_mode == MODE_3D)
     {
+#ifdef RECONSTRUCTOR_NORMALISE_T_F
+        #pragma omp parallel for num_threads(nThread)
+        SCALE_FT(_F3D, _sfF);
+#endif
 
 #ifndef NAN_NO_CHECK
-        SEGMENT_NAN_CHECK_COMPLEX(&_T3D[0], _T3D.sizeFT());
+        SEGMENT_NAN_CHECK_COMPLEX(&_F3D[0], _F3D.sizeFT());
 #endif
+    }
+    else
+    {
+        REPORT_ERROR("INEXISTENT MODE");
 
-        MPI_Allreduce_Large(&_T3D[0],
-                            2 * _T3D.sizeFT(),
-                            TS_MPI_DOUBLE,
-                            MPI_SUM,
-                            _hemi);
+        abort();
+    }
+}
+
+void Reconstructor::allReduceT(const unsigned int nThread)
+{
+    startAllReduceTF();
 
+    ALOG(INFO, "LOGGER_RECO") << "Waiting for Allreducing T in Hemisphere A";
+    BLOG(INFO, "LOGGER_RECO") << "Waiting for Allreducing T in Hemisphere B";
+
+    MPI_Wait_Large(_reqT);
+
+    if (_mode == MODE_2D)
+    {
 #ifndef NAN_NO_CHECK
-        SEGMENT_NAN_CHECK_COMPLEX(&_T3D[0], _T3D.sizeFT());
+        SEGMENT_NAN_CHECK(_T2D.dataFT(), _T2D.sizeFT());
+#endif
+    }
+    else if (_mode == MODE_3D)
+    {
+#ifndef NAN_NO_CHECK
+        SEGMENT_NAN_CHECK(_T3D.dataFT(), _T3D.sizeFT());
 #endif
     }
     else
@@ -2450,35 +2441,24 @@ void Reconstructor::allReduceT(const unsigned int nThread)
         abort();
     }
 
-    MPI_Barrier(_hemi);
-
 #ifdef RECONSTRUCTOR_NORMALISE_T_F
     ALOG(INFO, "LOGGER_RECO") << "Normalising T and F";
     BLOG(INFO, "LOGGER_RECO") << "Normalising T and F";
 
+    // _F is still being all reduced, it is scaled in allReduceF
     if (_mode == MODE_2D)
     {
-        RFLOAT sf = 1.0 / REAL(_T2D[0]);
+        _sfF = 1.0 / _T2D[0];
 
         #pragma omp parallel for num_threads(nThread)
-        SCALE_FT(_T2D, sf);
-        #pragma omp parallel for num_threads(nThread)
-        SCALE_FT(_F2D, sf);
+        SCALE_FT(_T2D, _sfF);
     }
     else if (_mode == MODE_3D)
     {
-        RFLOAT sf = 1.0 / REAL(_T3D[0]);
+        _sfF = 1.0 / _T3D[0];
 
         #pragma omp parallel for num_threads(nThread)
-        SCALE_FT(_T3D, sf);
-        #pragma omp parallel for num_threads(nThread)
-        SCALE_FT(_F3D, sf);
-    }
-    else
-    {
-        REPORT_ERROR("INEXISTENT MODE");
-
-        abort();
+        SCALE_FT(_T3D, _sfF);
     }
 #endif
 }
@@ -2528,25 +2508,21 @@ RFLOAT Reconstructor::checkC(const unsigned int nThread) const
 
     if (_mode == MODE_2D)
     {
-        #pragma omp parallel for schedule(dynamic) num_threads(nThread)
+        #pragma omp parallel for schedule(dynamic) num_threads(nThread) reduction(+:diff, counter)
         IMAGE_FOR_EACH_PIXEL_FT(_C2D)
             if (QUAD(i, j) < TSGSL_pow_2(_maxRadius * _pf))
             {
-                #pragma omp atomic
                 diff += fabs(ABS(_C2D.getFT(i, j)) - 1);
-                #pragma omp atomic
                 counter += 1;
             }
     }
     else if (_mode == MODE_3D)
     {
-        #pragma omp parallel for schedule(dynamic) num_threads(nThread)
+        #pragma omp parallel for schedule(dynamic) num_threads(nThread) reduction(+:diff, counter)
         VOLUME_FOR_EACH_PIXEL_FT(_C3D)
             if (QUAD_3(i, j, k) < TSGSL_pow_2(_maxRadius * _pf))
             {
-                #pragma omp atomic
                 diff += fabs(ABS(_C3D.getFT(i, j, k)) - 1);
-                #pragma omp atomic
                 counter += 1;
             }
     }
@@ -2563,25 +2539,25 @@ RFLOAT Reconstructor::checkC(const unsigned int nThread) const
 #ifdef RECONSTRUCTOR_CHECK_C_MAX
     if (_mode == MODE_2D)
     {
-        vector<RFLOAT> diff(_C2D.sizeFT(), 0);
-        
-        #pragma omp parallel for schedule(dynamic) num_threads(nThread)
+        RFLOAT diff = 0;
+
+        #pragma omp parallel for schedule(dynamic) num_threads(nThread) reduction(max:diff)
         IMAGE_FOR_EACH_PIXEL_FT(_C2D)
             if (QUAD(i, j) < TSGSL_pow_2(_maxRadius * _pf))
-                diff[_C2D.iFTHalf(i, j)] = fabs(ABS(_C2D.getFTHalf(i, j)) - 1);
+                diff = TSGSL_MAX_RFLOAT(diff, fabs(ABS(_C2D.getFTHalf(i, j)) - 1));
 
-        return *std::max_element(diff.begin(), diff.end());
+        return diff;
     }
     else if (_mode == MODE_3D)
     {
-        vector<RFLOAT> diff(_C3D.sizeFT(), 0);
+        RFLOAT diff = 0;
 
-        #pragma omp parallel for schedule(dynamic) num_threads(nThread)
+        #pragma omp parallel for schedule(dynamic) num_threads(nThread) reduction(max:diff)
         VOLUME_FOR_EACH_PIXEL_FT(_C3D)
             if (QUAD_3(i, j, k) < TSGSL_pow_2(_maxRadius * _pf))
-                diff[_C3D.iFTHalf(i, j, k)] = fabs(ABS(_C3D.getFTHalf(i, j, k)) - 1);
+                diff = TSGSL_MAX_RFLOAT(diff, fabs(ABS(_C3D.getFTHalf(i, j, k)) - 1));
 
-        return *std::max_element(diff.begin(), diff.end());
+        return diff;
     }
     else
     {
@@ -2594,12 +2570,30 @@ RFLOAT Reconstructor::checkC(const unsigned int nThread) const
 
 void Reconstructor::convoluteC(const unsigned int nThread)
 {
+    int nQuad = ((_mode == MODE_2D) ? 2 : 3) * (PAD_SIZE / 2 + 1) * (PAD_SIZE / 2 + 1);
+
+    if ((_kernelRLQuad.size() != nQuad) ||
+        (_kernelRLQuadA != _a) ||
+        (_kernelRLQuadAlpha != _alpha) ||
+        (_kernelRLQuadPf != _pf))
+    {
 #ifdef RECONSTRUCTOR_KERNEL_PADDING
-    RFLOAT nf = MKB_RL(0, _a * _pf, _alpha);
+        RFLOAT nf = MKB_RL(0, _a * _pf, _alpha);
 #else
-    RFLOAT nf = MKB_RL(0, _a, _alpha);
+        RFLOAT nf = MKB_RL(0, _a, _alpha);
 #endif
 
+        _kernelRLQuad.resize(nQuad);
+
+        #pragma omp parallel for num_threads(nThread)
+        for (int i = 0; i < nQuad; i++)
+            _kernelRLQuad(i) = _kernelRL(i / TSGSL_pow_2(_N * _pf)) / nf;
+
+        _kernelRLQuadA = _a;
+        _kernelRLQuadAlpha = _alpha;
+        _kernelRLQuadPf = _pf;
+    }
+
     if (_mode == MODE_2D)
     {
 #ifndef NAN_NO_CHECK
@@ -2614,9 +2608,7 @@ void Reconstructor::convoluteC(const unsigned int nThread)
 
         #pragma omp parallel for num_threads(nThread)
         IMAGE_FOR_EACH_PIXEL_RL(_C2D)
-            _C2D.setRL(_C2D.getRL(i, j)
-                     * _kernelRL(QUAD(i, j) / TSGSL_pow_2(_N * _pf))
-                     / nf,
+            _C2D.setRL(_C2D.getRL(i, j) * _kernelRLQuad(QUAD(i, j)),
                        i,
                        j);
 
@@ -2646,9 +2638,7 @@ void Reconstructor::convoluteC(const unsigned int nThread)
 
         #pragma omp parallel for num_threads(nThread)
         VOLUME_FOR_EACH_PIXEL_RL(_C3D)
-            _C3D.setRL(_C3D.getRL(i, j, k)
-                     * _kernelRL(QUAD_3(i, j, k) / TSGSL_pow_2(_N * _pf))
-                     / nf,
+            _C3D.setRL(_C3D.getRL(i, j, k) * _kernelRLQuad(QUAD_3(i, j, k)),
                        i,
                        j,
                        k);
@@ -2739,7 +2729,7 @@ Volume& Reconstructor::getF3D()
    return _F3D;
 }
 
-Volume& Reconstructor::getT3D()
+RealFTVolume& Reconstructor::getT3D()
 {
    return _T3D;
 }
@@ -0,0 +1,341 @@
+/** @file
+ *  @author Mingxu Hu
+ *  @version 1.4.14.090629
+ *  @copyright GPLv2
+ *
+ *  ChangeLog
+ *  AUTHOR      | TIME       | VERSION       | DESCRIPTION
+ *  ------      | ----       | -------       | -----------
+ *  Mingxu Hu   | 2019/07/08 | 1.4.14.090708 | new file
+ */
+
+#include <cfloat>
+#include <cstdlib>
+#include <queue>
+
+#include <gtest/gtest.h>
+
+#include <Mask.h>
+
+INITIALIZE_EASYLOGGINGPP
+
+static const unsigned int N_THREAD[] = {1, 2, 3, 4, 5, 7, 12, 16};
+
+static const int N_N_THREAD = sizeof(N_THREAD) / sizeof(N_THREAD[0]);
+
+static void randomMask(Volume& vol,
+                       const long nCol,
+                       const long nRow,
+                       const long nSlc,
+                       const RFLOAT density,
+                       const unsigned int seed)
+{
+    vol.alloc(nCol, nRow, nSlc, RL_SPACE);
+
+    srand(seed);
+
+    for (size_t i = 0; i < vol.sizeRL(); i++)
+        vol(i) = ((RFLOAT)rand() / RAND_MAX < density) ? 1 : 0;
+}
+
+/**
+ * spatial coordinate, from -n / 2 to n - n / 2 - 1, of memory index x along an axis of n voxels
+ */
+static inline long spatial(const long x,
+                           const long n)
+{
+    return (x < n - n / 2) ? x : x - n;
+}
+
+/**
+ * memory index of spatial coordinate c along an axis of n voxels
+ */
+static inline long memory(const long c,
+                          const long n)
+{
+    return (c >= 0) ? c : c + n;
+}
+
+/**
+ * brute-force square of the Euclidean distance of each voxel to the nearest voxel of a certain value
+ */
+static void bruteDistance(std::vector<RFLOAT>& dst,
+                          const Volume& src,
+                          const RFLOAT value)
+{
+    long nCol = src.nColRL();
+    long nRow = src.nRowRL();
+    long nSlc = src.nSlcRL();
+
+    dst.assign(src.sizeRL(), FLT_MAX);
+
+    for (long k = 0; k < nSlc; k++)
+        for (long j = 0; j < nRow; j++)
+            for (long i = 0; i < nCol; i++)
+            {
+                RFLOAT& d = dst[(k * nRow + j) * nCol + i];
+
+                for (long z = 0; z < nSlc; z++)
+                    for (long y = 0; y < nRow; y++)
+                        for (long x = 0; x < nCol; x++)
+                            if (src.iGetRL((z * nRow + y) * nCol + x) == value)
+                            {
+                                long di = spatial(x, nCol) - spatial(i, nCol);
+                                long dj = spatial(y, nRow) - spatial(j, nRow);
+                                long dk = spatial(z, nSlc) - spatial(k, nSlc);
+
+                                d = GSL_MIN(d, (RFLOAT)(di * di + dj * dj + dk * dk));
+                            }
+            }
+}
+
+/**
+ * brute-force labelling by breadth-first search over the neighbours in space, starting from the voxels in memory order
+ */
+static int bruteLabel(std::vector<int>& label,
+                      std::vector<size_t>& size,
+                      const Volume& vol)
+{
+    long nCol = vol.nColRL();
+    long nRow = vol.nRowRL();
+    long nSlc = vol.nSlcRL();
+
+    long n = vol.sizeRL();
+
+    label.assign(n, -1);
+    size.clear();
+
+    for (long s = 0; s < n; s++)
+    {
+        if ((vol.iGetRL(s) != 1) || (label[s] != -1)) continue;
+
+        int l = size.size();
+
+        size.push_back(0);
+
+        std::queue<long> q;
+
+        label[s] = l;
+        q.push(s);
+
+        while (!q.empty())
+        {
+            long v = q.front();
+            q.pop();
+
+            size[l]++;
+
+            long i = spatial(v % nCol, nCol);
+            long j = spatial((v / nCol) % nRow, nRow);
+            long k = spatial(v / (nCol * nRow), nSlc);
+
+            long nb[6][3] = {{i - 1, j, k}, {i + 1, j, k},
+                             {i, j - 1, k}, {i, j + 1, k},
+                             {i, j, k - 1}, {i, j, k + 1}};
+
+            for (int m = 0; m < 6; m++)
+            {
+                if ((nb[m][0] < -nCol / 2) || (nb[m][0] >= nCol - nCol / 2) ||
+                    (nb[m][1] < -nRow / 2) || (nb[m][1] >= nRow - nRow / 2) ||
+                    (nb[m][2] < -nSlc / 2) || (nb[m][2] >= nSlc - nSlc / 2))
+                    continue;
+
+                long u = (memory(nb[m][2], nSlc) * nRow + memory(nb[m][1], nRow)) * nCol + memory(nb[m][0], nCol);
+
+                if ((vol.iGetRL(u) == 1) && (label[u] == -1))
+                {
+                    label[u] = l;
+                    q.push(u);
+                }
+            }
+        }
+    }
+
+    return size.size();
+}
+
+/**
+ * blobs of known sizes in a volume of 8 x 8 x 12, given in spatial coordinates; most of them cross the boundaries between the slabs of slices, and the cube also crosses the wrap of the slices in memory
+ */
+class MaskComponentTest : public :: testing:: Test
+{
+    protected:
+
+        void SetUp()
+        {
+            _vol.alloc(8, 8, 12, RL_SPACE);
+
+            for (size_t i = 0; i < _vol.sizeRL(); i++)
+                _vol(i) = 0;
+
+            // a column through all the slices, 12 voxels
+            for (int k = -6; k < 6; k++)
+                set(-3, -3, k);
+
+            // a U of two columns joined at the last slice only, 25 voxels
+            for (int k = -6; k < 6; k++)
+            {
+                set(1, -2, k);
+                set(3, -2, k);
+            }
+            set(2, -2, 5);
+
+            // a cube of 2 x 2 x 2 across slices -1 and 0, 8 voxels
+            for (int k = -1; k < 1; k++)
+                for (int j = 1; j < 3; j++)
+                    for (int i = 0; i < 2; i++)
+                        set(i, j, k);
+
+            // an isolated voxel, 1 voxel
+            set(-1, 2, -3);
+        }
+
+        void set(const int i,
+                 const int j,
+                 const int k)
+        {
+            _vol((memory(k, 12) * 8 + memory(j, 8)) * 8 + memory(i, 8)) = 1;
+        }
+
+        Volume _vol;
+};
+
+TEST(MaskTest, DistanceTransformMatchesBruteForce)
+{
+    const long dim[][3] = {{8, 8, 1}, {10, 6, 1}, {6, 8, 10}, {8, 8, 8}};
+
+    for (int d = 0; d < 4; d++)
+        for (int t = 0; t < N_N_THREAD; t++)
+        {
+            Volume src;
+            randomMask(src, dim[d][0], dim[d][1], dim[d][2], 0.1, 17 * d + t);
+
+            std::vector<RFLOAT> ref;
+
+            for (int value = 0; value < 2; value++)
+            {
+                Volume dst;
+                distanceTransform(dst, src, value, N_THREAD[t]);
+
+                bruteDistance(ref, src, value);
+
+                ASSERT_EQ(dst.sizeRL(), ref.size());
+
+                for (size_t i = 0; i < ref.size(); i++)
+                    ASSERT_FLOAT_EQ(dst.iGetRL(i), ref[i])
+                        << "volume " << d << ", value " << value << ", " << N_THREAD[t] << " threads, voxel " << i;
+            }
+        }
+}
+
+TEST(MaskTest, DistanceTransformWithoutValue)
+{
+    Volume src;
+    randomMask(src, 6, 6, 6, 0, 1);
+
+    Volume dst;
+    distanceTransform(dst, src, 1, 4);
+
+    for (size_t i = 0; i < dst.sizeRL(); i++)
+        ASSERT_EQ(dst.iGetRL(i), FLT_MAX);
+}
+
+TEST(MaskTest, LabelComponentMatchesBruteForce)
+{
+    const long dim[][3] = {{16, 16, 1}, {6, 8, 10}, {8, 8, 16}};
+
+    const RFLOAT density[] = {0.2, 0.35, 0.5};
+
+    for (int d = 0; d < 3; d++)
+        for (int p = 0; p < 3; p++)
+        {
+            Volume vol;
+            randomMask(vol, dim[d][0], dim[d][1], dim[d][2], density[p], 31 * d + p);
+
+            std::vector<int> refLabel;
+            std::vector<size_t> refSize;
+
+            int refN = bruteLabel(refLabel, refSize, vol);
+
+            for (int t = 0; t < N_N_THREAD; t++)
+            {
+                vector<int> label;
+                vector<size_t> size;
+
+                int n = labelComponent(label, size, vol, N_THREAD[t]);
+
+                ASSERT_EQ(n, refN) << N_THREAD[t] << " threads";
+                ASSERT_EQ((int)size.size(), refN);
+
+                for (int l = 0; l < refN; l++)
+                    ASSERT_EQ(size[l], refSize[l]);
+
+                for (size_t i = 0; i < refLabel.size(); i++)
+                    ASSERT_EQ(label[i], refLabel[i]) << N_THREAD[t] << " threads, voxel " << i;
+            }
+        }
+}
+
+TEST_F(MaskComponentTest, LabelComponentAcrossSlabs)
+{
+    for (int t = 0; t < N_N_THREAD; t++)
+    {
+        vector<int> label;
+        vector<size_t> size;
+
+        ASSERT_EQ(labelComponent(label, size, _vol, N_THREAD[t]), 4) << N_THREAD[t] << " threads";
+
+        // numbered in the order of the first voxel of each component in memory,
+        // slice 0 coming first and slice -1 last
+        EXPECT_EQ(size[0], 8u);
+        EXPECT_EQ(size[1], 12u);
+        EXPECT_EQ(size[2], 25u);
+        EXPECT_EQ(size[3], 1u);
+    }
+}
+
+TEST_F(MaskComponentTest, FilterComponentKeepsLargest)
+{
+    for (int t = 0; t < N_N_THREAD; t++)
+    {
+        Volume vol = _vol.copyVolume();
+
+        filterComponent(vol, 2, 0, N_THREAD[t]);
+
+        vector<int> label;
+        vector<size_t> size;
+
+        ASSERT_EQ(labelComponent(label, size, vol, 1), 2) << N_THREAD[t] << " threads";
+
+        EXPECT_EQ(size[0], 12u);
+        EXPECT_EQ(size[1], 25u);
+    }
+}
+
+TEST_F(MaskComponentTest, FilterComponentDropsSmall)
+{
+    for (int t = 0; t < N_N_THREAD; t++)
+    {
+        Volume vol = _vol.copyVolume();
+
+        filterComponent(vol, 0, 8, N_THREAD[t]);
+
+        vector<int> label;
+        vector<size_t> size;
+
+        ASSERT_EQ(labelComponent(label, size, vol, 1), 3) << N_THREAD[t] << " threads";
+
+        EXPECT_EQ(size[0], 8u);
+        EXPECT_EQ(size[1], 12u);
+        EXPECT_EQ(size[2], 25u);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    loggerInit(argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,182 @@
+/** @file
+ *  @author Mingxu Hu
+ *  @version 1.4.14.090629
+ *  @copyright GPLv2
+ *
+ *  ChangeLog
+ *  AUTHOR      | TIME       | VERSION       | DESCRIPTION
+ *  ------      | ----       | -------       | -----------
+ *  Mingxu Hu   | 2019/07/08 | 1.4.14.090708 | new file
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Logging.h>
+#include <ShellReduce.h>
+
+INITIALIZE_EASYLOGGINGPP
+
+static const unsigned int N_THREAD[] = {1, 2, 3, 4, 7, 16};
+
+static const int N_N_THREAD = sizeof(N_THREAD) / sizeof(N_THREAD[0]);
+
+/**
+ * brute-force shell reduction, voxel by voxel; a voxel at square distance d to the origin belongs to shell u if and only if u * u - u < d <= u * u + u
+ */
+template <class F>
+static void bruteShellReduce(dvec& sum,
+                             const F& f,
+                             const long nCol,
+                             const long nRow,
+                             const long nSlc,
+                             const int r,
+                             const size_t lineBegin,
+                             const size_t lineEnd)
+{
+    long nColFT = nCol / 2 + 1;
+
+    sum = dvec::Zero((F::N + 1) * r);
+
+    double s[F::N];
+
+    for (size_t line = lineBegin; line < lineEnd; line++)
+    {
+        long j = line % nRow;
+        long k = line / nRow;
+
+        j = (2 * j < nRow) ? j : j - nRow;
+        k = (2 * k < nSlc) ? k : k - nSlc;
+
+        for (long i = 0; i < nColFT; i++)
+        {
+            long d = i * i + j * j + k * k;
+
+            long u = 0;
+
+            while (d > u * u + u) u++;
+
+            if (u >= r) continue;
+
+            for (int n = 0; n < F::N; n++) s[n] = 0;
+
+            f(s, (line - lineBegin) * nColFT + i);
+
+            for (int n = 0; n < F::N; n++) sum(n * r + u) += s[n];
+
+            sum(F::N * r + u) += 1;
+        }
+    }
+}
+
+template <class F>
+static void expectShellReduce(const F& f,
+                              const long nCol,
+                              const long nRow,
+                              const long nSlc,
+                              const int r,
+                              const size_t lineBegin,
+                              const size_t lineEnd)
+{
+    dvec ref;
+    bruteShellReduce(ref, f, nCol, nRow, nSlc, r, lineBegin, lineEnd);
+
+    for (int t = 0; t < N_N_THREAD; t++)
+    {
+        dvec sum;
+        shellReduce(sum, f, nCol, nRow, nSlc, r, N_THREAD[t], lineBegin, lineEnd);
+
+        ASSERT_EQ(sum.size(), ref.size());
+
+        for (int u = 0; u < r; u++)
+        {
+            // number of voxels
+            ASSERT_EQ(sum(F::N * r + u), ref(F::N * r + u))
+                << nCol << " x " << nRow << " x " << nSlc << ", " << N_THREAD[t] << " threads, shell " << u;
+
+            for (int n = 0; n < F::N; n++)
+                ASSERT_NEAR(sum(n * r + u), ref(n * r + u), 1e-9 * (1 + fabs(ref(n * r + u))))
+                    << nCol << " x " << nRow << " x " << nSlc << ", " << N_THREAD[t] << " threads, shell " << u << ", statistic " << n;
+        }
+    }
+}
+
+class ShellReduceTest : public :: testing:: TestWithParam<int>
+{
+    protected:
+
+        void SetUp()
+        {
+            static const long dim[][3] = {{16, 16, 1}, {15, 9, 1}, {12, 10, 8}, {9, 11, 7}};
+
+            _nCol = dim[GetParam()][0];
+            _nRow = dim[GetParam()][1];
+            _nSlc = dim[GetParam()][2];
+
+            size_t size = (_nCol / 2 + 1) * _nRow * _nSlc;
+
+            srand(GetParam() + 1);
+
+            _a.resize(size);
+            _b.resize(size);
+            _x.resize(size);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                _a[i] = COMPLEX((RFLOAT)rand() / RAND_MAX - 0.5, (RFLOAT)rand() / RAND_MAX - 0.5);
+                _b[i] = COMPLEX((RFLOAT)rand() / RAND_MAX - 0.5, (RFLOAT)rand() / RAND_MAX - 0.5);
+                _x[i] = (RFLOAT)rand() / RAND_MAX;
+            }
+        }
+
+        long _nCol;
+        long _nRow;
+        long _nSlc;
+
+        std::vector<Complex> _a;
+        std::vector<Complex> _b;
+        std::vector<RFLOAT> _x;
+};
+
+TEST_P(ShellReduceTest, SumMatchesBruteForce)
+{
+    size_t nLine = _nRow * _nSlc;
+
+    // shells up to the Nyquist frequency, and up to beyond the corner
+    expectShellReduce(ShellSum(&_x[0]), _nCol, _nRow, _nSlc, _nCol / 2, 0, nLine);
+    expectShellReduce(ShellSum(&_x[0]), _nCol, _nRow, _nSlc, 2 * _nCol, 0, nLine);
+}
+
+TEST_P(ShellReduceTest, FSCMatchesBruteForce)
+{
+    size_t nLine = _nRow * _nSlc;
+
+    expectShellReduce(ShellSumFSC(&_a[0], &_b[0]), _nCol, _nRow, _nSlc, _nCol / 2, 0, nLine);
+    expectShellReduce(ShellSumFSC(&_a[0], &_b[0]), _nCol, _nRow, _nSlc, 2 * _nCol, 0, nLine);
+}
+
+TEST_P(ShellReduceTest, LineRangeMatchesBruteForce)
+{
+    size_t nLine = _nRow * _nSlc;
+
+    size_t lineBegin = nLine / 3;
+    size_t lineEnd = 2 * nLine / 3 + 1;
+
+    // the index passed to the functor counts from the first voxel of line lineBegin
+    size_t offset = lineBegin * (_nCol / 2 + 1);
+
+    expectShellReduce(ShellSumAbs2(&_a[offset]), _nCol, _nRow, _nSlc, 2 * _nCol, lineBegin, lineEnd);
+}
+
+INSTANTIATE_TEST_CASE_P(Dimension, ShellReduceTest, ::testing::Range(0, 4));
+
+int main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    loggerInit(argc, argv);
+
+    return RUN_ALL_TESTS();
+}